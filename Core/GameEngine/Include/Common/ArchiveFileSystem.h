@@ -104,6 +104,21 @@ public:
 	ArchivedFileInfoMap								m_files;
 };
 
+// TheSuperHackers @performance Flat lookup of archived files by their normalized path, so that finding a file
+// takes one hash lookup instead of one map lookup per directory. The directory tree remains the owner of the
+// file locations and is used for directory searches. The iterator points to the first location of the file,
+// which has the highest priority. Further locations of the same file follow it in the directory tree.
+struct ArchivedFileLookupInfo
+{
+	ArchivedDirectoryInfo *dirInfo;
+	ArchivedFileLocationMap::iterator first;
+};
+
+typedef std::hash_map<
+	rts::string_key<AsciiString>, ArchivedFileLookupInfo,
+	rts::string_key_hash<AsciiString>,
+	rts::string_key_equal<AsciiString> > ArchivedFileLookupMap; // Normalized archived file path to archived file locations
+
 class ArchivedFileInfo
 {
 public:
@@ -162,10 +177,16 @@ protected:
 
 	ArchivedDirectoryInfoResult getArchivedDirectoryInfo(const Char* directory);
 
+	static Bool buildArchivedFileKey(const Char *filename, Char *key, Int keySize); ///< normalize the file path the same way the directory tree resolves it
+	ArchiveFile* findArchiveFile(const Char *filename, FileInstance instance) const;
+
 	virtual void loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool overwrite = FALSE);	///< load the archive file's header information and apply it to the global archive directory tree.
 
+	static Bool loadBIGFileDirectory(File *fp, const AsciiString& archiveFileName, Int numFiles, Int directoryEnd, ArchiveFile *archiveFile); ///< read the directory listing of a BIG file and add its files to the archive file.
+
 	ArchiveFileMap m_archiveFileMap;
 	ArchivedDirectoryInfo m_rootDirectory;
+	ArchivedFileLookupMap m_archivedFiles;
 };
 
 
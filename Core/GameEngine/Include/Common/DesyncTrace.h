@@ -0,0 +1,51 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// TheSuperHackers @feature Headless tool to find where two simulations of the same replay diverge,
+// for example with two builds or two option sets. While simulating, it writes a line per logic frame
+// with the GameLogic CRC and the CRCs of the blocks that make it up. The first line that differs
+// between two traces is the first diverging frame. At a chosen frame it writes a dump of the logic
+// state with XferDump, with the CRC of every object and the xfer data of every object, module and
+// logic subsystem, so that two dumps can be compared down to the object, module and field.
+// scripts/desync_bisect.py runs the simulations and compares the traces and dumps.
+class DesyncTrace
+{
+public:
+
+	/// Starts the trace. Returns false if the trace file could not be written.
+	static Bool begin( const AsciiString &filename, Int dumpFrame );
+	static void end();
+	static Bool isEnabled() { return s_file != nullptr; }
+
+	static void beginReplay( const AsciiString &replayFilename );
+
+	/** Call between logic frames. Writes the trace line of the next frame, and the dump if the next
+		* frame is the dump frame. Returns true after the dump was written, the simulation can stop then. */
+	static Bool update();
+
+	/// Writes the logic state dump. Returns false if the dump could not be written.
+	static Bool writeDump( const AsciiString &filename );
+
+private:
+
+	static FILE *s_file;
+	static AsciiString s_filename;
+	static Int s_dumpFrame;
+};
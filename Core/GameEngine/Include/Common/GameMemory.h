@@ -59,6 +59,12 @@
 	#define MEMORYPOOL_DEBUG
 #endif
 
+// TheSuperHackers @performance Let registered threads cache freed pool blocks in magazines of their own.
+// Not in debug mode, whose bookkeeping of every single block needs the pool lock anyway.
+#if !defined(MEMORYPOOL_DEBUG) && !defined(MEMORYPOOL_MAGAZINES) && !defined(DISABLE_MEMORYPOOL_MAGAZINES)
+	#define MEMORYPOOL_MAGAZINES
+#endif
+
 // SYSTEM INCLUDES ////////////////////////////////////////////////////////////
 
 #include <new.h>
@@ -219,6 +225,7 @@
 
 class MemoryPoolSingleBlock;
 class MemoryPoolBlob;
+class MemoryPoolMagazine;
 class MemoryPool;
 class MemoryPoolFactory;
 class DynamicMemoryAllocator;
@@ -246,6 +253,12 @@ enum
 	MAX_DYNAMICMEMORYALLOCATOR_SUBPOOLS = 8	///< The max number of subpools allowed in a DynamicMemoryAllocator
 };
 
+enum
+{
+	MAX_MEMORYPOOL_MAGAZINE_THREADS = 16,		///< The max number of threads that cache blocks in magazines at once
+	MEMORYPOOL_MAGAZINE_SIZE = 32						///< The max number of free blocks a thread caches per pool
+};
+
 #ifdef MEMORYPOOL_CHECKPOINTING
 // ----------------------------------------------------------------------------
 /**
@@ -300,12 +313,15 @@ private:
 	Int								m_allocationSize;						///< size of the blocks allocated by this pool, in bytes
 	Int								m_initialAllocationCount;		///< number of blocks to be allocated in initial blob
 	Int								m_overflowAllocationCount;	///< number of blocks to be allocated in any subsequent blob(s)
-	Int								m_usedBlocksInPool;					///< total number of blocks in use in the pool.
+	Int								m_usedBlocksInPool;					///< total number of blocks in use in the pool. blocks cached in magazines are not in use.
 	Int								m_totalBlocksInPool;				///< total number of blocks in all blobs of this pool (used or not).
 	Int								m_peakUsedBlocksInPool;			///< high-water mark of m_usedBlocksInPool
 	MemoryPoolBlob		*m_firstBlob;								///< head of linked list: first blob for this pool.
 	MemoryPoolBlob		*m_lastBlob;								///< tail of linked list: last blob for this pool. (needed for efficiency)
 	MemoryPoolBlob		*m_firstBlobWithFreeBlocks;	///< first blob in this pool that has at least one unallocated block.
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPoolMagazine	*m_magazines[MAX_MEMORYPOOL_MAGAZINE_THREADS];	///< free blocks cached by each registered thread, created on first use.
+#endif
 
 private:
 	/// create a new blob with the given number of blocks.
@@ -314,12 +330,32 @@ private:
 	/// destroy a blob.
 	Int freeBlob(MemoryPoolBlob *blob);
 
+	/// count a block that was handed out, and update the high-water mark.
+	void noteBlockAllocated();
+
+	/// count a block that was given back.
+	void noteBlockFreed();
+
+#ifdef MEMORYPOOL_MAGAZINES
+	/// return the magazine of the given thread slot, creating it if necessary. (the pool lock must be held)
+	MemoryPoolMagazine *getMagazine(Int slot);
+
+	/// take free blocks from the existing blobs until the magazine is half full. (the pool lock must be held)
+	void refillMagazine(Int slot);
+
+	/// give blocks of the magazine back to their blobs until keepCount are left. (the pool lock must be held)
+	void drainMagazine(Int slot, Int keepCount);
+#endif
+
 public:
 
 	// 'public' funcs that are really only for use by MemoryPoolFactory
 	MemoryPool *getNextPoolInList();					///< return next pool in linked list
 	void addToList(MemoryPool **pHead);				///< add this pool to head of the linked list
 	void removeFromList(MemoryPool **pHead);	///< remove this pool from the linked list
+	#ifdef MEMORYPOOL_MAGAZINES
+		void flushMagazine(Int slot);						///< give all blocks of the magazine of the given thread slot back to their blobs
+	#endif
 	#ifdef MEMORYPOOL_DEBUG
 		static void debugPoolInfoReport( MemoryPool *pool, FILE *fp = nullptr );	///< dump a report about this pool to the logfile
 		const char *debugGetBlockTagString(void *pBlock);		///< return the tagstring for the given block (assumed to belong to this pool)
@@ -363,10 +399,13 @@ public:
 	/// return the number of blocks in use in this pool.
 	Int getUsedBlockCount();
 
+	/// return the number of free blocks that threads keep in their magazines. they count as free blocks.
+	Int getCachedBlockCount();
+
 	/// return the total number of blocks in this pool. [ == getFreeBlockCount() + getUsedBlockCount() ]
 	Int getTotalBlockCount();
 
-	/// return the high-water mark for getUsedBlockCount()
+	/// return the high-water mark for getUsedBlockCount(). threads may cache free blocks in magazines on top of this.
 	Int getPeakBlockCount();
 
 	/// return the initial allocation count for this pool
@@ -374,10 +413,10 @@ public:
 
 	Int countBlobsInPool();
 
-	/// if this pool has any empty blobs, return them to the system.
+	/// if this pool has any empty blobs, return them to the system. blobs with blocks in magazines are not empty.
 	Int releaseEmpties();
 
-	/// destroy all blocks and blobs in this pool.
+	/// destroy all blocks and blobs in this pool. no other thread may use the pool meanwhile.
 	void reset();
 
 	#ifdef MEMORYPOOL_DEBUG
@@ -547,6 +586,14 @@ public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = nullptr );
 
+	/// return the sum of the high-water marks of all pools, in bytes.
+	Int getPeakPoolBytes();
+
+	#ifdef MEMORYPOOL_MAGAZINES
+		/// give all blocks of the magazines of the given thread slot back to their blobs.
+		void flushMagazines(Int slot);
+	#endif
+
 	#ifdef MEMORYPOOL_DEBUG
 
 		/// perform internal consistency checking
@@ -778,6 +825,9 @@ inline const char *MemoryPool::getPoolName() { return m_poolName; }
 inline Int MemoryPool::getAllocationSize() { return m_allocationSize; }
 inline Int MemoryPool::getFreeBlockCount() { return getTotalBlockCount() - getUsedBlockCount(); }
 inline Int MemoryPool::getUsedBlockCount() { return m_usedBlocksInPool; }
+#ifndef MEMORYPOOL_MAGAZINES
+inline Int MemoryPool::getCachedBlockCount() { return 0; }
+#endif
 inline Int MemoryPool::getTotalBlockCount() { return m_totalBlocksInPool; }
 inline Int MemoryPool::getPeakBlockCount() { return m_peakUsedBlocksInPool; }
 inline Int MemoryPool::getInitialBlockCount() { return m_initialAllocationCount; }
@@ -817,6 +867,20 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+/**
+	TheSuperHackers @performance Let the calling thread cache freed blocks of every pool in a magazine
+	of its own, and allocate from it without taking the pool lock. This is for long-lived threads that
+	allocate a lot, and does nothing if MAX_MEMORYPOOL_MAGAZINE_THREADS threads use magazines already.
+	Call endMemoryPoolMagazines() on the same thread before it exits.
+*/
+extern void beginMemoryPoolMagazines();
+
+/**
+	Give the blocks of the magazines of the calling thread back to their pools, and stop caching blocks
+	for the thread.
+*/
+extern void endMemoryPoolMagazines();
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
@@ -65,6 +65,7 @@ class MemoryPoolFactory
 public:
 
 	void memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead = nullptr );
+	Int getPeakPoolBytes();
 
 #ifdef MEMORYPOOL_DEBUG
 
@@ -139,6 +140,9 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+extern void beginMemoryPoolMagazines();
+extern void endMemoryPoolMagazines();
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
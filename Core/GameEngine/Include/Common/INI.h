@@ -220,6 +220,7 @@ public:
   static void parseMultiplayerStartingMoneyChoiceDefinition( INI* ini );
 	static void parseOnlineChatColorDefinition( INI* ini );
 	static void parseMapCacheDefinition( INI* ini );
+	static void parseReplayCatalogDefinition( INI* ini );
 	static void parseVideoDefinition( INI* ini );
 	static void parseCommandButtonDefinition( INI *ini );
 	static void parseCommandSetDefinition( INI *ini );
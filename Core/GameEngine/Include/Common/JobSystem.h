@@ -0,0 +1,128 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/SubsystemInterface.h"
+
+class Job;
+class JobDeque;
+class JobWorkerThread;
+
+// Runs the items [begin, end) of a job.
+typedef void (*JobFunction)(void *data, Int begin, Int end);
+// Accumulates the items [begin, end) into partial, which starts as a copy of the identity value.
+typedef void (*JobReduceFunction)(void *data, Int begin, Int end, void *partial);
+// Combines partial into result.
+typedef void (*JobCombineFunction)(void *data, void *result, const void *partial);
+
+//-------------------------------------------------------------------------------------------------
+/** Counts the unfinished jobs that were created for it. Jobs can only be waited on through their
+	* group, because a job is deleted as soon as it has run.
+	*/
+class JobGroup
+{
+public:
+	JobGroup() : m_unfinishedJobs(0) { }
+	~JobGroup() { DEBUG_ASSERTCRASH(m_unfinishedJobs == 0, ("JobGroup destroyed with unfinished jobs")); }
+
+	Bool isDone() const { return m_unfinishedJobs == 0; }
+
+private:
+	friend class JobSystem;
+	volatile long m_unfinishedJobs;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature Fixed size pool of worker threads with work stealing.
+	*
+	* Every thread, the main thread included, owns a lock-free deque. A thread pushes and pops the
+	* jobs it submits at the bottom of its own deque, and idle threads steal from the top of the
+	* others. Threads that wait for a job group run jobs in the meantime, so jobs may submit and
+	* wait for other jobs. Without worker threads every job runs on the calling thread.
+	*
+	* Jobs run in no particular order and on any thread. Game logic must only use them for work whose
+	* result does not depend on that order, such as parallelReduce, to stay deterministic.
+	*/
+class JobSystem : public SubsystemInterface
+{
+public:
+
+	enum
+	{
+		MAX_THREADS = 16, ///< Including the main thread
+		MAX_JOB_SUCCESSORS = 8,
+	};
+
+	JobSystem();
+	virtual ~JobSystem() override;
+
+	virtual void init() override;
+	virtual void reset() override { }
+	virtual void update() override { }
+
+	/// Number of threads that run jobs, including the main thread.
+	Int getThreadCount() const { return m_threadCount; }
+
+	/** Creates a job that runs function(data, begin, end) once it is submitted and all jobs it
+		* depends on have run. The job counts as unfinished in group until it has run.
+		*/
+	Job *createJob(JobFunction function, void *data, Int begin, Int end, JobGroup *group);
+
+	/// Lets after run only when before has run. Both jobs must not be submitted yet.
+	void addDependency(Job *before, Job *after);
+
+	/// Queues the job, or holds it back until the jobs it depends on have run. Every created job must be submitted once.
+	void submit(Job *job);
+
+	/// Runs jobs until every job of the group has run.
+	void wait(JobGroup *group);
+
+	/** Calls function(data, begin, end) for consecutive ranges of [0, count) in parallel and
+		* returns when all have run. A grain size of 0 picks one from the thread count.
+		*/
+	void parallelFor(Int count, Int grainSize, JobFunction function, void *data);
+
+	/** Reduces [0, count) in parallel. Each range of grainSize items is reduced into its own copy
+		* of result, and the partial results are then combined into result in range order. The split
+		* only depends on count and grainSize, so the result is the same for any thread count.
+		* result must hold the identity value on entry and be plain data of resultSize bytes.
+		*/
+	void parallelReduce(Int count, Int grainSize, JobReduceFunction reduce, JobCombineFunction combine,
+		void *data, void *result, Int resultSize);
+
+private:
+
+	friend class JobWorkerThread;
+
+	Int getCurrentThreadIndex() const;
+	void push(Job *job, Int threadIndex);
+	Job *findJob(Int threadIndex);
+	void execute(Job *job, Int threadIndex);
+	void workerLoop(Int threadIndex);
+
+	Int m_threadCount;
+	UnsignedInt m_threadIds[MAX_THREADS];
+	JobDeque *m_deques[MAX_THREADS];
+	JobWorkerThread *m_workers[MAX_THREADS];
+	void *m_wakeSemaphore;
+	volatile long m_sleepingWorkers;
+	volatile Bool m_quit;
+};
+
+extern JobSystem *TheJobSystem;
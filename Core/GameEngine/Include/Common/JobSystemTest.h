@@ -0,0 +1,38 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class JobSystemTest
+{
+public:
+
+	// TheSuperHackers @feature Stress tests TheJobSystem and checks the results of its jobs.
+	// Prints one line per test.
+	// Returns exit code 1 if a test failed
+	// Returns exit code 0 if all tests passed
+	static int run();
+
+private:
+
+	static Bool testStealing();
+	static Bool testNestedParallelFor();
+	static Bool testDependencies();
+	static Bool testParallelReduce();
+	static Bool testPoolContention();
+};
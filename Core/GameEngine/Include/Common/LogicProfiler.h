@@ -0,0 +1,118 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// TheSuperHackers @feature Headless profiler for the game logic.
+// Records wall time and call counts per update module, script action, script condition, pathfinder
+// call and partition manager query. Unlike the Tracy profiler it needs no server and is available
+// in every build, so it can be used with -headless -replay. It costs one branch per section while
+// disabled. The report is a JSON file with per-section totals and a collapsed stack file that can
+// be turned into a flamegraph. The report also contains the logic frame rate, per-frame time
+// percentiles and work counters, so it can be compared against a baseline to detect regressions.
+class LogicProfiler
+{
+public:
+
+	enum Category
+	{
+		CATEGORY_GAME_LOGIC,
+		CATEGORY_UPDATE_MODULE, ///< id is the module NameKeyType
+		CATEGORY_SCRIPT_ACTION, ///< id is the ScriptAction::ScriptActionType
+		CATEGORY_SCRIPT_CONDITION, ///< id is the Condition::ConditionType
+		CATEGORY_PATHFINDER, ///< name is the Pathfinder function
+		CATEGORY_PARTITION_MANAGER, ///< name is the PartitionManager function
+
+		CATEGORY_COUNT
+	};
+
+	enum Counter
+	{
+		COUNTER_PATHFIND_CELLS_EXPANDED,
+
+		COUNTER_COUNT
+	};
+
+	static void setEnabled(Bool enabled);
+	static Bool isEnabled() { return s_enabled; }
+
+	static void reset();
+
+	// Call at the start and end of every logic frame.
+	static void beginFrame();
+	static void endFrame();
+
+	// Use LogicProfileSection instead of calling these directly.
+	static void beginSection(Category category, Int id, const char *name);
+	static void endSection();
+
+	static void addToCounter(Counter counter, Int amount)
+	{
+		if (s_enabled)
+			s_counters[counter] += amount;
+	}
+
+	// Writes <basename>.json and <basename>.folded. Returns false if a file could not be written.
+	static Bool writeReport(const AsciiString &basename);
+
+private:
+
+	static Bool s_enabled;
+	static Int64 s_counters[COUNTER_COUNT];
+};
+
+class LogicProfileSection
+{
+public:
+	LogicProfileSection(LogicProfiler::Category category, Int id, const char *name = nullptr) : m_active(LogicProfiler::isEnabled())
+	{
+		if (m_active)
+			LogicProfiler::beginSection(category, id, name);
+	}
+	~LogicProfileSection()
+	{
+		if (m_active)
+			LogicProfiler::endSection();
+	}
+
+private:
+	Bool m_active;
+};
+
+class LogicProfileFrame
+{
+public:
+	LogicProfileFrame() : m_active(LogicProfiler::isEnabled())
+	{
+		if (m_active)
+			LogicProfiler::beginFrame();
+	}
+	~LogicProfileFrame()
+	{
+		if (m_active)
+			LogicProfiler::endFrame();
+	}
+
+private:
+	Bool m_active;
+};
+
+#define LOGIC_PROFILE_SECTION(category, id) LogicProfileSection logicProfileSection(LogicProfiler::category, id)
+#define LOGIC_PROFILE_SECTION_NAME(category, name) LogicProfileSection logicProfileSection(LogicProfiler::category, 0, name)
+#define LOGIC_PROFILE_FRAME LogicProfileFrame logicProfileFrame
+#define LOGIC_PROFILE_COUNT(counter, amount) LogicProfiler::addToCounter(LogicProfiler::counter, amount)
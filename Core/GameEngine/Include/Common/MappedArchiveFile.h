@@ -0,0 +1,52 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// MappedArchiveFile.h
+// Read only file view over archive data that is mapped into memory.
+
+#pragma once
+
+#include "Common/RAMFile.h"
+
+//===============================
+// MappedArchiveFile
+//===============================
+/**
+	* A RAMFile that does not own its data. The data points directly into a memory mapped archive,
+	* so opening a file does neither allocate nor copy. The archive must stay mapped until the file is closed.
+	*/
+//===============================
+
+class MappedArchiveFile : public RAMFile
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(MappedArchiveFile, "MappedArchiveFile")
+
+	public:
+
+		MappedArchiveFile();
+		//virtual				~MappedArchiveFile();
+
+		virtual void	close() override;																			///< Close the file
+
+		virtual Bool	open( File *file ) override;																	///< Not supported, the data must come from a mapped archive
+		virtual Bool	openFromArchive(File *archiveFile, const AsciiString& filename, Int offset, Int size) override; ///< Not supported, use openFromMappedArchive
+
+		Bool					openFromMappedArchive(const Char *data, const AsciiString& filename, Int size); ///< reference the given mapped data without copying it.
+
+		virtual char* readEntireAndClose() override;														///< returns a copy of the data, because the mapped data is not owned by this file
+};
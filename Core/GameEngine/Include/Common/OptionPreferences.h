@@ -128,4 +128,7 @@ public:
 	Real getResolutionFontAdjustment();
 
 	Bool getShowMoneyPerMinute() const;
+
+	Bool getCompressSaveGames() const;
+	Bool getIncrementalSaveGames() const;
 };
@@ -34,5 +34,7 @@ extern void InitRandom();
 extern void InitRandom( UnsignedInt seed );
 extern UnsignedInt GetGameLogicRandomSeed();   ///< Get the seed (used for replays)
 extern UnsignedInt GetGameLogicRandomSeedCRC();///< Get the seed (used for CRCs)
+extern void GetGameLogicRandomState( UnsignedInt state[6] );       ///< Get the generator state (used for replay checkpoints)
+extern void SetGameLogicRandomState( const UnsignedInt state[6] ); ///< Set the generator state (used for replay checkpoints)
 
 //--------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,68 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/Recorder.h"
+
+// TheSuperHackers @performance The replay catalog keeps the headers of the replays in the replay folder
+// in ReplayCatalog.ini, like MapCache.ini does for maps. A header is only read again when the size or
+// the modification time of its file changed, so listing a large replay folder does not open every replay.
+struct ReplayCatalogEntry
+{
+	ReplayCatalogEntry()
+		: m_filesize(0)
+		, m_timestampLow(0)
+		, m_timestampHigh(0)
+		, m_isValid(FALSE)
+		, m_doesExist(FALSE)
+	{}
+
+	RecorderClass::ReplayHeader m_header;		///< m_header.filename is the file name in the replay folder
+	UnsignedInt m_filesize;
+	UnsignedInt m_timestampLow;
+	UnsignedInt m_timestampHigh;
+	Bool m_isValid;													///< false if the file is not a readable replay
+	Bool m_doesExist;
+};
+
+// Keyed by the lower case file name.
+class ReplayCatalog : public std::map<AsciiString, ReplayCatalogEntry>
+{
+public:
+	ReplayCatalog() : m_doLoadCatalogINI(TRUE) {}
+
+	/// Reads the headers of new and changed replays, and writes the catalog if anything changed.
+	void updateCatalog();
+
+	/// Reads the headers of all replays and writes the catalog. Returns the number of valid replays.
+	Int rebuildCatalog();
+
+	/// Returns the entry of a valid replay in the replay folder. Call updateCatalog first.
+	const ReplayCatalogEntry *findReplay(const AsciiString &filename) const;
+
+private:
+	void loadCatalogINI();
+	void writeCatalogINI();
+	Bool loadReplaysFromDisk(); // returns true if the catalog changed
+
+	static const char *const m_catalogName;
+	Bool m_doLoadCatalogINI;
+};
+
+extern ReplayCatalog *TheReplayCatalog;
@@ -0,0 +1,90 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class File;
+
+// TheSuperHackers @feature Replay checkpoints hold the game state of a replay at regular logic frames.
+// They are stored in a file next to the replay, so that the playback can continue from the nearest
+// checkpoint instead of simulating the replay from the start. The file is only valid for the replay
+// and the executable it was written with, which the key and CRCs in its header make sure of.
+struct ReplayCheckpoint
+{
+	UnsignedInt frame;											///< logic frame that comes next after restoring the checkpoint
+	UnsignedInt logicCRC;										///< GameLogic CRC of the state, to verify the restored state
+	std::vector<UnsignedByte> playbackState;	///< state of the replay playback, written by the recorder
+	std::vector<UnsignedByte> gameState;			///< uncompressed game state, written by GameState::saveGameToBuffer
+};
+
+struct ReplayCheckpointIndexEntry
+{
+	UnsignedInt frame;
+	Int fileOffset;
+};
+
+typedef std::vector<ReplayCheckpointIndexEntry> ReplayCheckpointIndex;
+
+//-------------------------------------------------------------------------------------------------
+/** Writes the checkpoints of a replay in frame order. The index is written on close, a file that
+	* was not closed is not readable. */
+//-------------------------------------------------------------------------------------------------
+class ReplayCheckpointWriter
+{
+public:
+
+	ReplayCheckpointWriter();
+	~ReplayCheckpointWriter();
+
+	Bool open( const AsciiString &filepath, UnsignedInt replayKey );
+	Bool write( const ReplayCheckpoint &checkpoint );
+	void close();
+
+	Bool isOpen() const { return m_file != nullptr; }
+
+private:
+
+	File *m_file;
+	ReplayCheckpointIndex m_index;
+	std::vector<UnsignedByte> m_compressBuffer;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Reads the checkpoints of a replay. */
+//-------------------------------------------------------------------------------------------------
+class ReplayCheckpointReader
+{
+public:
+
+	ReplayCheckpointReader();
+	~ReplayCheckpointReader();
+
+	/// Fails if the file is missing, incomplete or was not written for this replay and executable.
+	Bool open( const AsciiString &filepath, UnsignedInt replayKey );
+	void close();
+
+	const ReplayCheckpointIndex &getIndex() const { return m_index; }
+
+	/// Reads the last checkpoint at or before frame.
+	Bool read( UnsignedInt frame, ReplayCheckpoint &checkpoint );
+
+private:
+
+	File *m_file;
+	ReplayCheckpointIndex m_index;
+};
@@ -0,0 +1,120 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/MessageStream.h"
+
+class File;
+class ReplayCommandDecodeThread;
+
+struct ReplayCommandArgument
+{
+	GameMessageArgumentDataType type;
+	GameMessageArgumentType value;
+};
+
+/// A replay command as it was recorded, without its GameMessage.
+struct ReplayCommand
+{
+	UnsignedInt frame;												///< logic frame the command is executed on
+	Int position;															///< file position after the frame number of the command
+	Int type;																	///< GameMessage::Type
+	Int playerIndex;
+	Int firstArgument;												///< index of the first argument in the chunk
+	Int argumentCount;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance Decodes the commands of a replay file ahead of the playback.
+	*
+	* The file is read in large blocks and the commands are decoded in chunks into contiguous arrays,
+	* so the playback neither reads every field from the file nor allocates a GameMessageParser per
+	* command. With read ahead, a background thread decodes the next chunks while the logic runs.
+	* The file must not be used by anyone else while the reader is open.
+	*/
+//-------------------------------------------------------------------------------------------------
+class ReplayCommandReader
+{
+public:
+
+	ReplayCommandReader();
+	~ReplayCommandReader();
+
+	/// Starts decoding at the current file position, which must be at the frame number of a command.
+	void open( File *file, Bool readAhead );
+	void close();
+
+	Bool isOpen() const { return m_file != nullptr; }
+
+	/// Returns the next command, or null at the end of the file. It is valid until the next call.
+	const ReplayCommand *next();
+
+	/// Returns the arguments of the command last returned by next.
+	const ReplayCommandArgument *getArguments( const ReplayCommand *command ) const;
+
+	/// Continues decoding at a file position, which must be at the frame number of a command.
+	void seek( Int position );
+
+private:
+
+	friend class ReplayCommandDecodeThread;
+
+	enum
+	{
+		CHUNK_COUNT = 4,
+		CHUNK_COMMANDS = 512,
+		READ_BLOCK_BYTES = 64 * 1024,
+	};
+
+	struct Chunk
+	{
+		std::vector<ReplayCommand> commands;
+		std::vector<ReplayCommandArgument> arguments;
+		Bool endOfFile;
+	};
+
+	void start( Bool readAhead );
+	void stop();
+	void decodeLoop();
+	void decodeChunk( Chunk &chunk );
+	Bool decodeCommand( Chunk &chunk );
+	Bool ensure( Int bytes );
+	void readBytes( void *data, Int bytes );
+
+	File *m_file;
+	Bool m_readAhead;
+
+	// Raw file data, m_readBuffer[0] is at m_readBufferPosition in the file
+	std::vector<UnsignedByte> m_readBuffer;
+	Int m_readBufferPosition;
+	Int m_readOffset;
+	Int m_readEnd;
+	Bool m_endOfFile;
+
+	// Chunks are filled and consumed in ring order
+	Chunk m_chunks[CHUNK_COUNT];
+	Int m_currentChunk;
+	Int m_currentCommand;
+	Bool m_hasCurrentChunk;
+
+	ReplayCommandDecodeThread *m_thread;
+	void *m_freeChunks;																///< semaphore counting the chunks the thread may fill
+	void *m_filledChunks;															///< semaphore counting the chunks the playback may consume
+	volatile Bool m_quit;
+};
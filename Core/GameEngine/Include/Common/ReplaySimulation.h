@@ -36,8 +36,11 @@ public:
 
 private:
 
+	static int simulateReplayInThisProcess(const AsciiString &filename);
 	static int simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames);
 	static int simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses);
+	static int simulateReplaysInPersistentWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses);
+	static int simulateReplaysAsWorker(const std::vector<AsciiString> &filenames);
 	static std::vector<AsciiString> resolveFilenameWildcards(const std::vector<AsciiString> &filenames);
 
 private:
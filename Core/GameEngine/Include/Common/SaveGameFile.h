@@ -0,0 +1,89 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+class SaveGameWriteThread;
+
+//-------------------------------------------------------------------------------------------------
+/** TheSuperHackers @performance Writes save game files in the background.
+	*
+	* The game is saved into memory first, then a background thread compresses the data and writes
+	* it to the file, so the game only waits for the serialisation. Every top level block of the save
+	* data is compressed on its own. A compressed file starts with a tag, followed by the number of
+	* blocks, and the size and the compressed data of each block. Files without the tag are plain save
+	* data, so older save files still load. The data is written to a temporary file first, which then
+	* replaces the file, so a failed write keeps the previous save.
+	*
+	* With incremental writes, the blocks of the previous write are kept, and blocks that did not
+	* change since then reuse their compressed data instead of being compressed again.
+	*/
+//-------------------------------------------------------------------------------------------------
+class SaveGameFile
+{
+public:
+
+	SaveGameFile();
+	~SaveGameFile();
+
+	/** Opens a temporary file and writes the save data to it in the background. Takes the data and
+		* leaves it empty. Waits for the previous write first. Returns false if the file cannot be opened.
+		*/
+	Bool write( const AsciiString &filepath, std::vector<UnsignedByte> &data, Bool compress, Bool incremental );
+
+	/// Returns true while the last write has not finished.
+	Bool isWriting() const;
+
+	/// Waits until the last write finished. Returns false if it failed.
+	Bool waitForWrite();
+
+	/// Forgets the blocks kept for incremental writes.
+	void clearPreviousBlocks();
+
+	/** Reads the save data of a plain or compressed file. Only the first maxBlocks top level blocks
+		* are read, or all if it is negative.
+		*/
+	static Bool readFile( const AsciiString &filepath, std::vector<UnsignedByte> &data, Int maxBlocks = -1 );
+
+private:
+
+	friend class SaveGameWriteThread;
+
+	void writeFile();
+	void splitBlocks();
+	Bool compressBlocks();
+
+	// Written by the thread while it runs
+	FILE *m_fp;
+	char m_filepath[_MAX_PATH];
+	char m_tempFilepath[_MAX_PATH];
+	std::vector<UnsignedByte> m_data;
+	std::vector<Int> m_blockOffsets;													///< begin of each block in m_data, and the end of the data
+	std::vector< std::vector<UnsignedByte> > m_compressedBlocks;
+	Bool m_compress;
+	Bool m_incremental;
+	volatile Bool m_writeSucceeded;
+
+	// Blocks of the previous incremental write
+	std::vector<UnsignedByte> m_previousData;
+	std::vector<Int> m_previousBlockOffsets;
+	std::vector< std::vector<UnsignedByte> > m_previousCompressedBlocks;
+
+	SaveGameWriteThread *m_thread;
+	void *m_writeDone;																				///< event that is set when the thread finished writing
+};
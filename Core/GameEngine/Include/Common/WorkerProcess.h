@@ -26,7 +26,8 @@ class WorkerProcess
 public:
 	WorkerProcess();
 
-	bool startProcess(UnicodeString command);
+	// If redirectStdInput is true, text can be sent to the process with writeStdInput.
+	bool startProcess(UnicodeString command, bool redirectStdInput = false);
 
 	void update();
 
@@ -38,6 +39,15 @@ public:
 	DWORD getExitCode() const;
 	AsciiString getStdOutput() const;
 
+	// Discard the console output that has been received so far
+	void clearStdOutput();
+
+	// Send text to the stdin of the process. Requires the process to be started with redirectStdInput.
+	bool writeStdInput(const AsciiString& text);
+
+	// Close stdin of the process, which signals end of input to the process
+	void closeStdInput();
+
 	// Terminate Process if it's running
 	void kill();
 
@@ -49,6 +59,7 @@ private:
 private:
 	HANDLE m_processHandle;
 	HANDLE m_readHandle;
+	HANDLE m_stdInWriteHandle;
 	HANDLE m_jobHandle;
 	AsciiString m_stdOutput;
 	DWORD m_exitcode;
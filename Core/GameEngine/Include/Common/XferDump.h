@@ -0,0 +1,61 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/Xfer.h"
+
+// TheSuperHackers @feature Saves snapshots like XferSave, but writes every xfered value as a line
+// of text with its type and index in the enclosing block. Strings, marker labels and blocks are
+// kept, so two dumps of the same state can be diffed down to the module and field that differs.
+class XferDump : public Xfer
+{
+
+public:
+
+	XferDump();
+	virtual ~XferDump() override;
+
+	virtual void open( AsciiString identifier ) override;		///< open text file for writing
+	virtual void close() override;											///< close file
+	virtual Int beginBlock() override;									///< begin a nested block of fields
+	virtual void endBlock() override;									///< end the last begun block
+	virtual void skip( Int dataSize ) override;							///< skipping during a write is a no-op
+
+	virtual void xferSnapshot( Snapshot *snapshot ) override;		///< runs the xfer function of the snapshot
+
+	virtual void xferBool( Bool *boolData ) override;
+	virtual void xferInt( Int *intData ) override;
+	virtual void xferUnsignedInt( UnsignedInt *unsignedIntData ) override;
+	virtual void xferReal( Real *realData ) override;
+	virtual void xferMarkerLabel( AsciiString asciiStringData ) override;
+	virtual void xferAsciiString( AsciiString *asciiStringData ) override;
+	virtual void xferUnicodeString( UnicodeString *unicodeStringData ) override;
+
+	void beginSection( const AsciiString &name );		///< starts a new top level section of the dump
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize ) override;
+
+	void writeIndent();
+	Int nextFieldIndex();
+
+	FILE *m_fileFP;
+	std::vector<Int> m_fieldIndices;			///< index of the next field per open block
+};
@@ -0,0 +1,49 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/XferLoad.h"
+
+// TheSuperHackers @feature XferLoad that reads from memory instead of a file. The data is not
+// copied and must stay valid until the xfer is closed.
+class XferLoadBuffer : public XferLoad
+{
+
+public:
+
+	XferLoadBuffer( const UnsignedByte *data, Int dataSize );
+	virtual ~XferLoadBuffer() override;
+
+	virtual void open( AsciiString identifier ) override;				///< start reading at the begin of the buffer
+	virtual void close() override;													///< stop reading
+	virtual Int beginBlock() override;														///< read placeholder block size
+	virtual void skip( Int dataSize ) override;									///< skip forward dataSize bytes in the buffer
+
+	Int getPosition() const { return m_position; }
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize ) override;		///< the xfer implementation
+
+	const UnsignedByte *m_data;
+	Int m_dataSize;
+	Int m_position;
+	Bool m_isOpen;
+
+};
@@ -0,0 +1,50 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/XferSave.h"
+
+// TheSuperHackers @feature XferSave that writes to memory instead of a file, so game states can be
+// kept or processed further without going through the disk.
+class XferSaveBuffer : public XferSave
+{
+
+public:
+
+	XferSaveBuffer();
+	virtual ~XferSaveBuffer() override;
+
+	virtual void open( AsciiString identifier ) override;		///< start a new empty buffer
+	virtual void close() override;											///< finish the buffer, the data stays available
+	virtual Int beginBlock() override;									///< write placeholder block size
+	virtual void endBlock() override;									///< write size of the last begun block
+	virtual void skip( Int dataSize ) override;							///< append dataSize zero bytes, like XferSave leaves at the end of a file
+
+	const std::vector<UnsignedByte> &getBuffer() const { return m_buffer; }
+	std::vector<UnsignedByte> &getBuffer() { return m_buffer; }
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize ) override;		///< the xfer implementation
+
+	std::vector<UnsignedByte> m_buffer;
+	std::vector<size_t> m_blockStack;						///< buffer offsets of the begun blocks
+	Bool m_isOpen;
+
+};
@@ -208,6 +208,7 @@ enum {MAX_WALL_PIECES = 128};
 class PathfindCellInfo
 {
 	friend class PathfindCell;
+	friend class PathfindCellList;
 public:
 #if RETAIL_COMPATIBLE_PATHFINDING
 	static void forceCleanPathFindCellInfos();
@@ -230,6 +231,9 @@ protected:
 
 	UnsignedShort m_totalCost, m_costSoFar;	///< cost estimates for A* search
 
+	Int m_openHeapIndex;									///< index in the open list heap, if on it
+	UnsignedInt m_openSequence;						///< insertion order on the open list, to break ties between equal costs
+
 	/// have to include cell's coordinates, since cells are often accessed via pointer only
 	ICoord2D m_pos;
 
@@ -249,28 +253,43 @@ protected:
 };
 
 // TheSuperHackers @info The PathfindCellList class acts as a new management class for the pathfindcell open and closed lists
+// TheSuperHackers @performance The open list keeps its cells in a binary heap ordered by total cost, with
+// ties broken by insertion order. This yields the same expansion order as the sorted linked list did,
+// with logarithmic instead of linear insertion. The linked list still holds all cells on the list, in
+// insertion order, for releasing them. The retail compatible pathfinding keeps using the sorted list.
 class PathfindCellList
 {
 	friend class PathfindCell;
 
 public:
-	PathfindCellList() : m_head(nullptr), m_tail(nullptr) {}
+	PathfindCellList() : m_head(nullptr), m_tail(nullptr), m_nextSequence(0) {}
 
 #if RETAIL_COMPATIBLE_PATHFINDING
-	void reset(PathfindCell* newHead = nullptr) { m_head = newHead; m_tail = nullptr; }
+	void reset(PathfindCell* newHead = nullptr) { m_head = newHead; m_tail = nullptr; m_heap.clear(); m_nextSequence = 0; }
 #else
-	void reset() { m_head = nullptr; m_tail = nullptr; }
+	void reset() { m_head = nullptr; m_tail = nullptr; m_heap.clear(); m_nextSequence = 0; }
 #endif
 
-	PathfindCell* getHead() const { return m_head; }
+	/// Returns the cell with the lowest total cost, or the first cell if the list is not sorted by heap.
+	PathfindCell* getHead() const { return m_heap.empty() ? m_head : m_heap.front()->m_cell; }
+
+	/// Returns the first cell in list order, to walk all cells on the list with getNextOpen().
+	PathfindCell* getFirst() const { return m_head; }
 
 	Bool empty() const { return m_head == nullptr; }
 
-	Bool canReverseSort(PathfindCell& currentCell) const;
+private:
+	void heapPush(PathfindCellInfo* info);
+	void heapRemove(PathfindCellInfo* info);
+	void heapSiftUp(Int index);
+	void heapSiftDown(Int index);
+	static Bool heapLess(const PathfindCellInfo* a, const PathfindCellInfo* b);
 
 private:
 	PathfindCell* m_head;
 	PathfindCell* m_tail;
+	std::vector<PathfindCellInfo*> m_heap;
+	UnsignedInt m_nextSequence;
 };
 
 /**
@@ -338,12 +357,6 @@ public:
 	void forwardInsertionSortRetailCompatible(PathfindCellList& list);
 #endif
 
-	// Forward insertion sort, in ascending cost order
-	void forwardInsertionSort(PathfindCellList& list);
-
-	// Reverse insertion sort, in ascending cost order
-	void reverseInsertionSort(PathfindCellList& list);
-
 	/// put self on "open" list in ascending cost order
 	void putOnSortedOpenList( PathfindCellList &list );
 
@@ -376,8 +389,6 @@ public:
 	inline UnsignedInt getCostSoFar() const {return m_info->m_costSoFar;}
 	inline UnsignedInt getTotalCost() const {return m_info->m_totalCost;}
 
-	inline UnsignedInt getTotalCostDifference(PathfindCell& other) const;
-
 	inline void setCostSoFar(UnsignedInt cost) { if( m_info ) m_info->m_costSoFar = cost;}
 	inline void setTotalCost(UnsignedInt cost) { if( m_info ) m_info->m_totalCost = cost;}
 
@@ -493,6 +504,8 @@ private:
 
 enum { PATHFIND_QUEUE_LEN=512};
 
+typedef std::hash_map<ObjectID, Int, rts::hash<ObjectID>, rts::equal_to<ObjectID> > QueuedPathfindRequestMap;
+
 struct TCheckMovementInfo;
 
 /**
@@ -916,6 +929,7 @@ private:
 	ObjectID			m_queuedPathfindRequests[PATHFIND_QUEUE_LEN];
 	Int						m_queuePRHead;
 	Int						m_queuePRTail;
+	QueuedPathfindRequestMap m_queuedPathfindRequestSlots;	///< Queue slot of each queued object, to check for already queued objects without scanning the queue
 	Int						m_cumulativeCellsAllocated;
 
 #if RTS_ZEROHOUR && RETAIL_COMPATIBLE_CRC
@@ -0,0 +1,170 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/DesyncTrace.h"
+
+#include "Common/PlayerList.h"
+#include "Common/RandomValue.h"
+#include "Common/Team.h"
+#include "Common/XferCRC.h"
+#include "Common/XferDump.h"
+#include "GameLogic/AI.h"
+#include "GameLogic/GameLogic.h"
+#include "GameLogic/Object.h"
+#include "GameLogic/PartitionManager.h"
+#include "GameLogic/ScriptEngine.h"
+#include "GameLogic/SidesList.h"
+
+
+FILE *DesyncTrace::s_file = nullptr;
+AsciiString DesyncTrace::s_filename;
+Int DesyncTrace::s_dumpFrame = -1;
+
+namespace
+{
+UnsignedInt getSnapshotCRC(Snapshot *snapshot)
+{
+	XferCRC xfer;
+	xfer.open("DesyncTrace");
+	xfer.xferSnapshot(snapshot);
+	xfer.close();
+	return xfer.getCRC();
+}
+
+UnsignedInt getObjectsCRC()
+{
+	XferCRC xfer;
+	xfer.open("DesyncTrace");
+	for (Object *obj = TheGameLogic->getFirstObject(); obj; obj = obj->getNextObject())
+		xfer.xferSnapshot(obj);
+	xfer.close();
+	return xfer.getCRC();
+}
+
+void dumpSnapshot(XferDump &xfer, const char *name, Snapshot *snapshot)
+{
+	xfer.beginSection(name);
+	xfer.xferSnapshot(snapshot);
+}
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+Bool DesyncTrace::begin( const AsciiString &filename, Int dumpFrame )
+{
+	end();
+
+	s_file = fopen(filename.str(), "wt");
+	if (s_file == nullptr)
+		return FALSE;
+
+	s_filename = filename;
+	s_dumpFrame = dumpFrame;
+	fprintf(s_file, "# frame logicCRC objectsCRC partitionCRC playersCRC aiCRC\n");
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DesyncTrace::end()
+{
+	if (s_file != nullptr)
+	{
+		fclose(s_file);
+		s_file = nullptr;
+	}
+	s_filename.clear();
+	s_dumpFrame = -1;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DesyncTrace::beginReplay( const AsciiString &replayFilename )
+{
+	if (s_file != nullptr)
+		fprintf(s_file, "# replay %s\n", replayFilename.str());
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool DesyncTrace::update()
+{
+	if (s_file == nullptr)
+		return FALSE;
+
+	const UnsignedInt frame = TheGameLogic->getFrame();
+	fprintf(s_file, "%u %08X %08X %08X %08X %08X\n",
+		frame,
+		TheGameLogic->getCRC(CRC_RECALC),
+		getObjectsCRC(),
+		getSnapshotCRC(ThePartitionManager),
+		getSnapshotCRC(ThePlayerList),
+		getSnapshotCRC(TheAI));
+
+	if (s_dumpFrame < 0 || frame != (UnsignedInt)s_dumpFrame)
+		return FALSE;
+
+	fflush(s_file);
+
+	AsciiString dumpFilename = s_filename;
+	dumpFilename.concat(".dump");
+	if (writeDump(dumpFilename))
+		printf("Logic state of frame %u dumped to \"%s\"\n", frame, dumpFilename.str());
+	else
+		printf("Cannot write logic state dump to \"%s\"\n", dumpFilename.str());
+	fflush(stdout);
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The objects go first and each in its own section, which holds the object CRC that goes into
+	* the GameLogic CRC and the save game data of the object and its modules. The dump uses the save
+	* game code, so the game should not continue after it. */
+//-------------------------------------------------------------------------------------------------
+Bool DesyncTrace::writeDump( const AsciiString &filename )
+{
+	XferDump xfer;
+	try
+	{
+		xfer.open(filename);
+
+		AsciiString section;
+		for (Object *obj = TheGameLogic->getFirstObject(); obj; obj = obj->getNextObject())
+		{
+			section.format("Object %u %s crc=%08X", (UnsignedInt)obj->getID(), obj->getTemplate()->getName().str(), getSnapshotCRC(obj));
+			dumpSnapshot(xfer, section.str(), obj);
+		}
+
+		dumpSnapshot(xfer, "ThePartitionManager", ThePartitionManager);
+		dumpSnapshot(xfer, "ThePlayerList", ThePlayerList);
+		dumpSnapshot(xfer, "TheAI", TheAI);
+		dumpSnapshot(xfer, "TheTeamFactory", TheTeamFactory);
+		dumpSnapshot(xfer, "TheScriptEngine", TheScriptEngine);
+		dumpSnapshot(xfer, "TheSidesList", TheSidesList);
+
+		UnsignedInt randomState[6];
+		GetGameLogicRandomState(randomState);
+		xfer.beginSection("GameLogicRandomState");
+		xfer.xferUser(randomState, sizeof(randomState));
+
+		xfer.close();
+	}
+	catch (...)
+	{
+		return FALSE;
+	}
+	return TRUE;
+}
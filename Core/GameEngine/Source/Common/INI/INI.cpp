@@ -135,6 +135,7 @@ static const BlockParse theTypeTable[] =
 	{ "PlayerTemplate",                 INI::parsePlayerTemplateDefinition },
 	{ "Rank",                           INI::parseRankDefinition },
 	{ "ReallyLowMHz",                   parseReallyLowMHz },
+	{ "ReplayCatalog",                  INI::parseReplayCatalogDefinition },
 	{ "Road",                           INI::parseTerrainRoadDefinition },
 	{ "Science",                        INI::parseScienceDefinition },
 	{ "ScriptAction",                   ScriptEngine::parseScriptAction },
@@ -243,29 +244,27 @@ UnsignedInt INI::loadDirectory( AsciiString dirName, INILoadType loadType, Xfer
 	TheFileSystem->getFileListInDirectory(dirName, "*.ini", filenameList, subdirs);
 	// Load the INI files in the dir now, in a sorted order.  This keeps things the same between machines
 	// in a network game.
+	// TheSuperHackers @performance The file list is walked once. Files of this directory are loaded
+	// right away and files in subdirectories are remembered in their sorted order to be loaded after,
+	// without copying every filename into a temporary string on both passes.
+	std::vector<const AsciiString*> subdirFiles;
 	FilenameList::const_iterator it = filenameList.begin();
-	while (it != filenameList.end())
+	for (; it != filenameList.end(); ++it)
 	{
-		AsciiString tempname;
-		tempname = (*it).str() + dirName.getLength();
+		const char* localName = (*it).str() + dirName.getLength();
 
-		if ((tempname.find('\\') == nullptr) && (tempname.find('/') == nullptr)) {
+		if (strpbrk(localName, "\\/") == nullptr) {
 			// this file doesn't reside in a subdirectory, load it first.
 			filesRead += load( *it, loadType, pXfer );
 		}
-		++it;
+		else {
+			subdirFiles.push_back(&(*it));
+		}
 	}
 
-	it = filenameList.begin();
-	while (it != filenameList.end())
+	for (size_t i = 0; i < subdirFiles.size(); ++i)
 	{
-		AsciiString tempname;
-		tempname = (*it).str() + dirName.getLength();
-
-		if ((tempname.find('\\') != nullptr) || (tempname.find('/') != nullptr)) {
-			filesRead += load( *it, loadType, pXfer );
-		}
-		++it;
+		filesRead += load( *subdirFiles[i], loadType, pXfer );
 	}
 
 	return filesRead;
@@ -322,35 +321,85 @@ void INI::unPrepFile()
 	s_xfer = nullptr;
 }
 
+//-------------------------------------------------------------------------------------------------
+// TheSuperHackers @performance Every line of every INI file resolves its first token against a block
+// or field parse table. The tables are static, so each one is indexed by token once on first use and
+// looked up through a hash map from then on, instead of being scanned with strcmp for every line.
+typedef std::hash_map<const char*, const BlockParse*, rts::hash<const char*>, rts::equal_to<const char*> > BlockParseIndex;
+typedef std::hash_map<const char*, const FieldParse*, rts::hash<const char*>, rts::equal_to<const char*> > FieldParseIndex;
+
+struct FieldParseTableHash
+{
+	size_t operator()(const FieldParse* parseTable) const
+	{
+		return reinterpret_cast<size_t>(parseTable) / sizeof(FieldParse);
+	}
+};
+
+typedef std::hash_map<const FieldParse*, FieldParseIndex, FieldParseTableHash, rts::equal_to<const FieldParse*> > FieldParseIndexMap;
+
+static BlockParseIndex s_blockParseIndex;
+static FieldParseIndexMap s_fieldParseIndexMap;
+
 //-------------------------------------------------------------------------------------------------
 static INIBlockParse findBlockParse(const char* token)
 {
-	for (size_t i = 0; i < ARRAY_SIZE(theTypeTable); ++i)
+	if (s_blockParseIndex.empty())
 	{
-		if (strcmp(theTypeTable[i].token, token) == 0)
+		for (size_t i = 0; i < ARRAY_SIZE(theTypeTable); ++i)
 		{
-			return theTypeTable[i].parse;
+			// insert keeps the first entry of duplicate tokens, same as the linear search did
+			s_blockParseIndex.insert(BlockParseIndex::value_type(theTypeTable[i].token, &theTypeTable[i]));
 		}
 	}
 
+	BlockParseIndex::const_iterator it = s_blockParseIndex.find(token);
+	if (it != s_blockParseIndex.end())
+	{
+		return it->second->parse;
+	}
+
 	return nullptr;
 }
 
+//-------------------------------------------------------------------------------------------------
+static const FieldParseIndex& getFieldParseIndex(const FieldParse* parseTable)
+{
+	FieldParseIndexMap::iterator it = s_fieldParseIndexMap.find(parseTable);
+	if (it != s_fieldParseIndexMap.end())
+	{
+		return it->second;
+	}
+
+	FieldParseIndex& index = s_fieldParseIndexMap[parseTable];
+	for (const FieldParse* parse = parseTable; parse->token; ++parse)
+	{
+		// insert keeps the first entry of duplicate tokens, same as the linear search did
+		index.insert(FieldParseIndex::value_type(parse->token, parse));
+	}
+
+	return index;
+}
+
 //-------------------------------------------------------------------------------------------------
 static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, int& offset, const void*& userData)
 {
-	const FieldParse* parse = parseTable;
-	for (; parse->token; ++parse)
+	const FieldParseIndex& index = getFieldParseIndex(parseTable);
+	FieldParseIndex::const_iterator it = index.find(token);
+	if (it != index.end())
 	{
-		if (strcmp( parse->token, token ) == 0)
-		{
-			offset = parse->offset;
-			userData = parse->userData;
-			return parse->parse;
-		}
+		const FieldParse* parse = it->second;
+		offset = parse->offset;
+		userData = parse->userData;
+		return parse->parse;
 	}
 
-	if (!parse->token && parse->parse)
+	// the table is terminated by an entry without token, which may hold a catch-all parse function
+	const FieldParse* parse = parseTable;
+	while (parse->token)
+		++parse;
+
+	if (parse->parse)
 	{
 		offset = parse->offset;
 		userData = token;
@@ -0,0 +1,163 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: INIReplayCatalog.cpp /////////////////////////////////////////////////////////////////////
+// Desc:   Parsing ReplayCatalog INI entries
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/INI.h"
+#include "Common/QuotedPrintable.h"
+#include "Common/ReplayCatalog.h"
+
+
+class ReplayCatalogEntryReader
+{
+public:
+	ReplayCatalogEntryReader()
+		: m_filesize(0)
+		, m_timestampLow(0)
+		, m_timestampHigh(0)
+		, m_isValid(FALSE)
+		, m_versionNumber(0)
+		, m_exeCRC(0)
+		, m_iniCRC(0)
+		, m_startTime(0)
+		, m_endTime(0)
+		, m_frameCount(0)
+		, m_quitEarly(FALSE)
+		, m_desyncGame(FALSE)
+		, m_playerDiscons(0)
+		, m_localPlayerIndex(-1)
+	{
+		memset(&m_timeVal, 0, sizeof(m_timeVal));
+	}
+
+	UnsignedInt m_filesize;
+	UnsignedInt m_timestampLow;
+	UnsignedInt m_timestampHigh;
+	Bool m_isValid;
+	AsciiString m_replayName;
+	SYSTEMTIME m_timeVal;
+	AsciiString m_versionString;
+	AsciiString m_versionTimeString;
+	UnsignedInt m_versionNumber;
+	UnsignedInt m_exeCRC;
+	UnsignedInt m_iniCRC;
+	Int m_startTime;
+	Int m_endTime;
+	UnsignedInt m_frameCount;
+	Bool m_quitEarly;
+	Bool m_desyncGame;
+	UnsignedInt m_playerDiscons;
+	AsciiString m_gameOptions;
+	Int m_localPlayerIndex;
+
+	static const FieldParse m_replayFieldParseTable[];		///< the parse table for INI definition
+	const FieldParse *getFieldParse() const { return m_replayFieldParseTable; }
+};
+
+
+static void parseSystemTime( INI* ini, void * /*instance*/, void *store, const void* /*userData*/ )
+{
+	SYSTEMTIME *time = (SYSTEMTIME *)store;
+	time->wYear = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+	time->wMonth = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+	time->wDayOfWeek = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+	time->wDay = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+	time->wHour = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+	time->wMinute = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+	time->wSecond = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+	time->wMilliseconds = (WORD)INI::scanUnsignedInt(ini->getNextToken());
+}
+
+const FieldParse ReplayCatalogEntryReader::m_replayFieldParseTable[] =
+{
+	{ "fileSize",								INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_filesize ) },
+	{ "timestampLo",						INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_timestampLow ) },
+	{ "timestampHi",						INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_timestampHigh ) },
+	{ "isValid",								INI::parseBool,					nullptr,	offsetof( ReplayCatalogEntryReader, m_isValid ) },
+	{ "replayName",							INI::parseAsciiString,	nullptr,	offsetof( ReplayCatalogEntryReader, m_replayName ) },
+	{ "date",										parseSystemTime,				nullptr,	offsetof( ReplayCatalogEntryReader, m_timeVal ) },
+	{ "versionString",					INI::parseAsciiString,	nullptr,	offsetof( ReplayCatalogEntryReader, m_versionString ) },
+	{ "versionTimeString",			INI::parseAsciiString,	nullptr,	offsetof( ReplayCatalogEntryReader, m_versionTimeString ) },
+	{ "versionNumber",					INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_versionNumber ) },
+	{ "exeCRC",									INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_exeCRC ) },
+	{ "iniCRC",									INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_iniCRC ) },
+	{ "startTime",							INI::parseInt,					nullptr,	offsetof( ReplayCatalogEntryReader, m_startTime ) },
+	{ "endTime",								INI::parseInt,					nullptr,	offsetof( ReplayCatalogEntryReader, m_endTime ) },
+	{ "frameCount",							INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_frameCount ) },
+	{ "quitEarly",							INI::parseBool,					nullptr,	offsetof( ReplayCatalogEntryReader, m_quitEarly ) },
+	{ "desyncGame",							INI::parseBool,					nullptr,	offsetof( ReplayCatalogEntryReader, m_desyncGame ) },
+	{ "playerDiscons",					INI::parseUnsignedInt,	nullptr,	offsetof( ReplayCatalogEntryReader, m_playerDiscons ) },
+	{ "gameOptions",						INI::parseAsciiString,	nullptr,	offsetof( ReplayCatalogEntryReader, m_gameOptions ) },
+	{ "localPlayerIndex",				INI::parseInt,					nullptr,	offsetof( ReplayCatalogEntryReader, m_localPlayerIndex ) },
+
+	{ nullptr,					nullptr,						nullptr,						0 }
+};
+
+void INI::parseReplayCatalogDefinition( INI* ini )
+{
+	const char *c;
+	AsciiString name;
+	ReplayCatalogEntryReader reader;
+	ReplayCatalogEntry entry;
+
+	// read the name
+	c = ini->getNextToken(" \n\r\t");
+	name.set( c );
+	name = QuotedPrintableToAsciiString(name);
+
+	ini->initFromINI( &reader, reader.getFieldParse() );
+
+	RecorderClass::ReplayHeader &header = entry.m_header;
+	header.filename = name;
+	header.forPlayback = FALSE;
+	header.replayName = QuotedPrintableToUnicodeString(reader.m_replayName);
+	header.timeVal = reader.m_timeVal;
+	header.versionString = QuotedPrintableToUnicodeString(reader.m_versionString);
+	header.versionTimeString = QuotedPrintableToUnicodeString(reader.m_versionTimeString);
+	header.versionNumber = reader.m_versionNumber;
+	header.exeCRC = reader.m_exeCRC;
+	header.iniCRC = reader.m_iniCRC;
+	header.startTime = reader.m_startTime;
+	header.endTime = reader.m_endTime;
+	header.frameCount = reader.m_frameCount;
+	header.quitEarly = reader.m_quitEarly;
+	header.desyncGame = reader.m_desyncGame;
+	for (Int i = 0; i < MAX_SLOTS; ++i)
+	{
+		header.playerDiscons[i] = (reader.m_playerDiscons & (1 << i)) != 0;
+	}
+	header.gameOptions = QuotedPrintableToAsciiString(reader.m_gameOptions);
+	header.localPlayerIndex = reader.m_localPlayerIndex;
+
+	entry.m_filesize = reader.m_filesize;
+	entry.m_timestampLow = reader.m_timestampLow;
+	entry.m_timestampHigh = reader.m_timestampHigh;
+	entry.m_isValid = reader.m_isValid;
+
+	if (TheReplayCatalog)
+	{
+		AsciiString lowerName = name;
+		lowerName.toLower();
+		(*TheReplayCatalog)[lowerName] = entry;
+	}
+}
@@ -0,0 +1,493 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/JobSystem.h"
+
+#include "thread.h"
+
+
+JobSystem *TheJobSystem = nullptr;
+
+namespace
+{
+// The casts keep these compatible with the older Platform SDK declarations of the Interlocked functions.
+inline long interlockedIncrement(volatile long *value)
+{
+	return InterlockedIncrement((LONG *)value);
+}
+
+inline long interlockedDecrement(volatile long *value)
+{
+	return InterlockedDecrement((LONG *)value);
+}
+
+inline void interlockedExchange(volatile long *target, long value)
+{
+	InterlockedExchange((LONG *)target, value);
+}
+
+inline long interlockedCompareExchange(volatile long *destination, long exchange, long comparand)
+{
+#if defined(_MSC_VER) && _MSC_VER < 1300
+	return (long)InterlockedCompareExchange((PVOID *)destination, (PVOID)exchange, (PVOID)comparand);
+#else
+	return InterlockedCompareExchange((LONG *)destination, exchange, comparand);
+#endif
+}
+
+// Not every supported Platform SDK has MemoryBarrier, but every Interlocked function is a full barrier.
+inline void fullMemoryBarrier()
+{
+	volatile long barrier = 0;
+	interlockedExchange(&barrier, 0);
+}
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+class Job : public MemoryPoolObject
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(Job, "JobPool")
+
+public:
+
+	Job(JobFunction function, void *data, Int begin, Int end, JobGroup *group)
+		: m_function(function)
+		, m_data(data)
+		, m_begin(begin)
+		, m_end(end)
+		, m_group(group)
+		, m_pendingCount(1)
+		, m_successorCount(0)
+		, m_submitted(false)
+	{
+	}
+
+	JobFunction m_function;
+	void *m_data;
+	Int m_begin;
+	Int m_end;
+	JobGroup *m_group;
+	volatile long m_pendingCount; ///< Jobs this one waits for, plus one until it is submitted
+	Job *m_successors[JobSystem::MAX_JOB_SUCCESSORS];
+	Int m_successorCount;
+	Bool m_submitted;
+};
+
+EMPTY_DTOR(Job)
+
+//-------------------------------------------------------------------------------------------------
+/** Chase-Lev work stealing deque of fixed capacity. Only the owning thread pushes and pops at the
+	* bottom. Any thread may steal from the top.
+	*/
+class JobDeque
+{
+public:
+
+	enum { CAPACITY = 1024 }; // Must be a power of two
+
+	JobDeque() : m_top(0), m_bottom(0) { }
+
+	Bool isEmpty() const { return m_bottom <= m_top; }
+
+	// Returns false if the deque is full.
+	Bool push(Job *job)
+	{
+		const long bottom = m_bottom;
+		if (bottom - m_top >= CAPACITY)
+			return false;
+
+		m_jobs[bottom & (CAPACITY - 1)] = job;
+		// The job must be visible before the new bottom is.
+		interlockedExchange(&m_bottom, bottom + 1);
+		return true;
+	}
+
+	Job *pop()
+	{
+		const long bottom = m_bottom - 1;
+		// Stealers must see the new bottom before top is read, so the last job is not taken twice.
+		interlockedExchange(&m_bottom, bottom);
+		const long top = m_top;
+
+		if (top > bottom)
+		{
+			m_bottom = bottom + 1;
+			return nullptr;
+		}
+
+		Job *job = m_jobs[bottom & (CAPACITY - 1)];
+		if (top == bottom)
+		{
+			// This is the last job. Whoever moves top first gets it.
+			if (interlockedCompareExchange(&m_top, top + 1, top) != top)
+				job = nullptr;
+			m_bottom = bottom + 1;
+		}
+		return job;
+	}
+
+	Job *steal()
+	{
+		const long top = m_top;
+		fullMemoryBarrier();
+		const long bottom = m_bottom;
+
+		if (top >= bottom)
+			return nullptr;
+
+		Job *job = m_jobs[top & (CAPACITY - 1)];
+		if (interlockedCompareExchange(&m_top, top + 1, top) != top)
+			return nullptr;
+		return job;
+	}
+
+private:
+
+	volatile long m_top;
+	volatile long m_bottom;
+	Job * volatile m_jobs[CAPACITY];
+};
+
+//-------------------------------------------------------------------------------------------------
+class JobWorkerThread : public ThreadClass
+{
+public:
+
+	JobWorkerThread(JobSystem *system, Int threadIndex)
+		: ThreadClass("JobWorkerThread")
+		, m_system(system)
+		, m_threadIndex(threadIndex)
+	{
+	}
+
+	virtual void Thread_Function() override
+	{
+		m_system->workerLoop(m_threadIndex);
+	}
+
+private:
+
+	JobSystem *m_system;
+	Int m_threadIndex;
+};
+
+namespace
+{
+struct ReduceRange
+{
+	JobReduceFunction reduce;
+	void *data;
+	void *partial;
+};
+
+void runReduceRange(void *data, Int begin, Int end)
+{
+	ReduceRange *range = static_cast<ReduceRange *>(data);
+	range->reduce(range->data, begin, end, range->partial);
+}
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+JobSystem::JobSystem()
+	: m_threadCount(0)
+	, m_wakeSemaphore(nullptr)
+	, m_sleepingWorkers(0)
+	, m_quit(false)
+{
+	for (Int i = 0; i < MAX_THREADS; ++i)
+	{
+		m_threadIds[i] = 0;
+		m_deques[i] = nullptr;
+		m_workers[i] = nullptr;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+JobSystem::~JobSystem()
+{
+	m_quit = true;
+
+	// Wake every worker. A release fails when the semaphore is already full, which wakes them as well.
+	if (m_wakeSemaphore != nullptr)
+	{
+		for (Int i = 1; i < m_threadCount; ++i)
+			ReleaseSemaphore((HANDLE)m_wakeSemaphore, 1, nullptr);
+	}
+
+	for (Int i = 0; i < MAX_THREADS; ++i)
+	{
+		// Waits for the thread to exit.
+		delete m_workers[i];
+		m_workers[i] = nullptr;
+	}
+
+	endMemoryPoolMagazines();
+
+	for (Int i = 0; i < MAX_THREADS; ++i)
+	{
+		DEBUG_ASSERTCRASH(m_deques[i] == nullptr || m_deques[i]->isEmpty(), ("JobSystem shut down with queued jobs"));
+		delete m_deques[i];
+		m_deques[i] = nullptr;
+	}
+
+	if (m_wakeSemaphore != nullptr)
+	{
+		CloseHandle((HANDLE)m_wakeSemaphore);
+		m_wakeSemaphore = nullptr;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::init()
+{
+	DEBUG_ASSERTCRASH(m_threadCount == 0, ("JobSystem is already initialized"));
+
+	// One thread per processor, the main thread included.
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	m_threadCount = clamp(1, (Int)systemInfo.dwNumberOfProcessors, (Int)MAX_THREADS);
+
+	m_threadIds[0] = ThreadClass::_Get_Current_Thread_ID();
+	// Jobs are pooled objects that are created and deleted on every thread.
+	beginMemoryPoolMagazines();
+	for (Int i = 0; i < m_threadCount; ++i)
+	{
+		m_deques[i] = NEW JobDeque;
+	}
+
+	if (m_threadCount > 1)
+	{
+		m_wakeSemaphore = CreateSemaphore(nullptr, 0, MAX_THREADS, nullptr);
+		for (Int i = 1; i < m_threadCount; ++i)
+		{
+			m_workers[i] = NEW JobWorkerThread(this, i);
+			m_workers[i]->Execute();
+		}
+	}
+
+	DEBUG_LOG(("JobSystem::init - Running jobs on %d threads", m_threadCount));
+}
+
+//-------------------------------------------------------------------------------------------------
+Job *JobSystem::createJob(JobFunction function, void *data, Int begin, Int end, JobGroup *group)
+{
+	Job *job = newInstance(Job)(function, data, begin, end, group);
+	if (group != nullptr)
+		interlockedIncrement(&group->m_unfinishedJobs);
+	return job;
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::addDependency(Job *before, Job *after)
+{
+	DEBUG_ASSERTCRASH(!before->m_submitted && !after->m_submitted, ("Dependencies must be added before the jobs are submitted"));
+	DEBUG_ASSERTCRASH(before->m_successorCount < MAX_JOB_SUCCESSORS, ("Too many jobs depend on this job"));
+	if (before->m_successorCount >= MAX_JOB_SUCCESSORS)
+		return;
+
+	before->m_successors[before->m_successorCount++] = after;
+	interlockedIncrement(&after->m_pendingCount);
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::submit(Job *job)
+{
+	DEBUG_ASSERTCRASH(!job->m_submitted, ("Job is submitted twice"));
+	job->m_submitted = true;
+
+	if (interlockedDecrement(&job->m_pendingCount) == 0)
+		push(job, getCurrentThreadIndex());
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::wait(JobGroup *group)
+{
+	const Int threadIndex = getCurrentThreadIndex();
+
+	while (group->m_unfinishedJobs > 0)
+	{
+		Job *job = threadIndex >= 0 ? findJob(threadIndex) : nullptr;
+		if (job != nullptr)
+			execute(job, threadIndex);
+		else
+			ThreadClass::Sleep_Ms(0);
+	}
+
+	// Makes the writes of the jobs visible to the caller.
+	fullMemoryBarrier();
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::parallelFor(Int count, Int grainSize, JobFunction function, void *data)
+{
+	if (count <= 0)
+		return;
+
+	if (grainSize <= 0)
+		grainSize = max(1, count / (m_threadCount * 4));
+
+	if (m_threadCount <= 1 || count <= grainSize)
+	{
+		function(data, 0, count);
+		return;
+	}
+
+	JobGroup group;
+	for (Int begin = 0; begin < count; begin += grainSize)
+	{
+		submit(createJob(function, data, begin, min(begin + grainSize, count), &group));
+	}
+	wait(&group);
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::parallelReduce(Int count, Int grainSize, JobReduceFunction reduce, JobCombineFunction combine,
+	void *data, void *result, Int resultSize)
+{
+	DEBUG_ASSERTCRASH(grainSize > 0, ("parallelReduce needs a fixed grain size to be deterministic"));
+	DEBUG_ASSERTCRASH(resultSize > 0, ("parallelReduce needs a result"));
+	if (count <= 0 || grainSize <= 0 || resultSize <= 0)
+		return;
+
+	const Int rangeCount = (count + grainSize - 1) / grainSize;
+	// Partial results are stored in Int64 units to keep them aligned.
+	const Int partialStride = (Int)((resultSize + sizeof(Int64) - 1) / sizeof(Int64));
+
+	std::vector<Int64> partials(rangeCount * partialStride);
+	std::vector<ReduceRange> ranges(rangeCount);
+
+	JobGroup group;
+	for (Int i = 0; i < rangeCount; ++i)
+	{
+		void *partial = &partials[i * partialStride];
+		memcpy(partial, result, resultSize);
+
+		ranges[i].reduce = reduce;
+		ranges[i].data = data;
+		ranges[i].partial = partial;
+
+		const Int begin = i * grainSize;
+		submit(createJob(runReduceRange, &ranges[i], begin, min(begin + grainSize, count), &group));
+	}
+	wait(&group);
+
+	for (Int i = 0; i < rangeCount; ++i)
+	{
+		combine(data, result, &partials[i * partialStride]);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+Int JobSystem::getCurrentThreadIndex() const
+{
+	const UnsignedInt threadId = ThreadClass::_Get_Current_Thread_ID();
+	for (Int i = 0; i < m_threadCount; ++i)
+	{
+		if (m_threadIds[i] == threadId)
+			return i;
+	}
+
+	DEBUG_CRASH(("Jobs can only be used from the main thread and from jobs"));
+	return -1;
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::push(Job *job, Int threadIndex)
+{
+	// Threads without a deque and full deques run the job right away.
+	if (threadIndex < 0 || !m_deques[threadIndex]->push(job))
+	{
+		execute(job, threadIndex);
+		return;
+	}
+
+	// The push is a full barrier, so a worker that goes to sleep after this read finds the job first.
+	if (m_sleepingWorkers > 0)
+		ReleaseSemaphore((HANDLE)m_wakeSemaphore, 1, nullptr);
+}
+
+//-------------------------------------------------------------------------------------------------
+Job *JobSystem::findJob(Int threadIndex)
+{
+	Job *job = m_deques[threadIndex]->pop();
+	if (job != nullptr)
+		return job;
+
+	for (Int i = 1; i < m_threadCount; ++i)
+	{
+		const Int victimIndex = (threadIndex + i) % m_threadCount;
+		job = m_deques[victimIndex]->steal();
+		if (job != nullptr)
+			return job;
+	}
+
+	return nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::execute(Job *job, Int threadIndex)
+{
+	job->m_function(job->m_data, job->m_begin, job->m_end);
+
+	for (Int i = 0; i < job->m_successorCount; ++i)
+	{
+		Job *successor = job->m_successors[i];
+		if (interlockedDecrement(&successor->m_pendingCount) == 0)
+			push(successor, threadIndex);
+	}
+
+	// The successors count in their groups already, so the group can not finish before they run.
+	if (job->m_group != nullptr)
+		interlockedDecrement(&job->m_group->m_unfinishedJobs);
+
+	deleteInstance(job);
+}
+
+//-------------------------------------------------------------------------------------------------
+void JobSystem::workerLoop(Int threadIndex)
+{
+	m_threadIds[threadIndex] = ThreadClass::_Get_Current_Thread_ID();
+	beginMemoryPoolMagazines();
+
+	while (!m_quit)
+	{
+		Job *job = findJob(threadIndex);
+		if (job != nullptr)
+		{
+			execute(job, threadIndex);
+			continue;
+		}
+
+		// Look once more after announcing the sleep, so a job pushed in between is not missed.
+		interlockedIncrement(&m_sleepingWorkers);
+		job = findJob(threadIndex);
+		if (job != nullptr)
+		{
+			interlockedDecrement(&m_sleepingWorkers);
+			execute(job, threadIndex);
+			continue;
+		}
+
+		WaitForSingleObject((HANDLE)m_wakeSemaphore, INFINITE);
+		interlockedDecrement(&m_sleepingWorkers);
+	}
+
+	endMemoryPoolMagazines();
+}
@@ -0,0 +1,450 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/JobSystemTest.h"
+
+#include "Common/JobSystem.h"
+
+#include "thread.h"
+
+
+namespace
+{
+inline void interlockedIncrement(volatile long *value)
+{
+	InterlockedIncrement((LONG *)value);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Every job splits its range in two child jobs until the range is small. The children are pushed to
+// the deque of the thread that runs the parent, so idle threads can only get work by stealing.
+
+enum
+{
+	STEAL_ITEM_COUNT = 1 << 15,
+	STEAL_LEAF_SIZE = 8,
+	STEAL_ROUNDS = 32,
+};
+
+struct StealTest
+{
+	volatile long itemCounts[STEAL_ITEM_COUNT];
+	UnsignedInt itemThreadIds[STEAL_ITEM_COUNT];
+};
+
+void runStealRange(void *data, Int begin, Int end)
+{
+	StealTest *test = static_cast<StealTest *>(data);
+
+	if (end - begin <= STEAL_LEAF_SIZE)
+	{
+		const UnsignedInt threadId = ThreadClass::_Get_Current_Thread_ID();
+		for (Int i = begin; i < end; ++i)
+		{
+			interlockedIncrement(&test->itemCounts[i]);
+			test->itemThreadIds[i] = threadId;
+		}
+		return;
+	}
+
+	const Int middle = begin + (end - begin) / 2;
+	JobGroup group;
+	TheJobSystem->submit(TheJobSystem->createJob(runStealRange, data, begin, middle, &group));
+	TheJobSystem->submit(TheJobSystem->createJob(runStealRange, data, middle, end, &group));
+	TheJobSystem->wait(&group);
+}
+
+//-------------------------------------------------------------------------------------------------
+enum
+{
+	NESTED_OUTER_COUNT = 64,
+	NESTED_INNER_COUNT = 1000,
+	NESTED_ROUNDS = 16,
+};
+
+void runNestedInner(void *data, Int begin, Int end)
+{
+	Int *values = static_cast<Int *>(data);
+	for (Int i = begin; i < end; ++i)
+	{
+		++values[i];
+	}
+}
+
+void runNestedOuter(void *data, Int begin, Int end)
+{
+	Int *values = static_cast<Int *>(data);
+	for (Int i = begin; i < end; ++i)
+	{
+		TheJobSystem->parallelFor(NESTED_INNER_COUNT, 0, runNestedInner, values + i * NESTED_INNER_COUNT);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+// A start job fans out to chains of steps, and a join job waits for the last step of every chain.
+// Each step checks that the step before it has run.
+
+enum
+{
+	CHAIN_COUNT = JobSystem::MAX_JOB_SUCCESSORS,
+	CHAIN_LENGTH = 32,
+	CHAIN_ROUNDS = 64,
+};
+
+struct ChainRound
+{
+	Bool started;
+	Bool joined;
+	Int progress[CHAIN_COUNT];
+	volatile long errors;
+};
+
+struct ChainStep
+{
+	ChainRound *round;
+	Int chain;
+	Int step;
+};
+
+void runChainStart(void *data, Int, Int)
+{
+	ChainRound *round = static_cast<ChainRound *>(data);
+	round->started = true;
+}
+
+void runChainStep(void *data, Int, Int)
+{
+	ChainStep *step = static_cast<ChainStep *>(data);
+	ChainRound *round = step->round;
+	if (!round->started || round->progress[step->chain] != step->step)
+		interlockedIncrement(&round->errors);
+	round->progress[step->chain] = step->step + 1;
+}
+
+void runChainJoin(void *data, Int, Int)
+{
+	ChainRound *round = static_cast<ChainRound *>(data);
+	for (Int i = 0; i < CHAIN_COUNT; ++i)
+	{
+		if (round->progress[i] != CHAIN_LENGTH)
+			interlockedIncrement(&round->errors);
+	}
+	round->joined = true;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Floating point addition is not associative, so the sum only repeats when the ranges are split
+// and combined the same way every time.
+
+enum
+{
+	REDUCE_COUNT = 100003,
+	REDUCE_GRAIN_SIZE = 1000,
+	REDUCE_ROUNDS = 16,
+};
+
+void reduceSum(void *data, Int begin, Int end, void *partial)
+{
+	const Real *values = static_cast<const Real *>(data);
+	Real *sum = static_cast<Real *>(partial);
+	for (Int i = begin; i < end; ++i)
+	{
+		*sum += values[i];
+	}
+}
+
+void combineSum(void *, void *result, const void *partial)
+{
+	*static_cast<Real *>(result) += *static_cast<const Real *>(partial);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Every item allocates a batch of pool blocks, fills them with a pattern of its own, checks it and
+// frees them again. The time per block is measured on this thread alone and on all threads at once,
+// which shows how much the threads wait for each other in the memory pools.
+
+enum
+{
+	POOL_ITEM_COUNT = 4096,
+	POOL_BATCH_SIZE = 64,
+	POOL_BLOCK_VALUES = 12,
+	POOL_ROUNDS = 16,
+};
+
+class JobSystemTestBlock : public MemoryPoolObject
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(JobSystemTestBlock, "JobSystemTestBlockPool")
+
+public:
+
+	Int m_values[POOL_BLOCK_VALUES];
+};
+
+EMPTY_DTOR(JobSystemTestBlock)
+
+void runPoolItems(void *data, Int begin, Int end)
+{
+	volatile long *errors = static_cast<volatile long *>(data);
+	JobSystemTestBlock *blocks[POOL_BATCH_SIZE];
+
+	for (Int i = begin; i < end; ++i)
+	{
+		for (Int b = 0; b < POOL_BATCH_SIZE; ++b)
+		{
+			blocks[b] = newInstance(JobSystemTestBlock);
+			for (Int v = 0; v < POOL_BLOCK_VALUES; ++v)
+			{
+				blocks[b]->m_values[v] = i * POOL_BATCH_SIZE + b + v;
+			}
+		}
+
+		for (Int b = 0; b < POOL_BATCH_SIZE; ++b)
+		{
+			for (Int v = 0; v < POOL_BLOCK_VALUES; ++v)
+			{
+				if (blocks[b]->m_values[v] != i * POOL_BATCH_SIZE + b + v)
+				{
+					interlockedIncrement(errors);
+					break;
+				}
+			}
+			deleteInstance(blocks[b]);
+		}
+	}
+}
+
+Bool runTest(const char *name, Bool (*test)())
+{
+	const UnsignedInt startTime = timeGetTime();
+	const Bool passed = test();
+	printf("%-20s %s in %u ms\n", name, passed ? "passed" : "FAILED", timeGetTime() - startTime);
+	return passed;
+}
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+int JobSystemTest::run()
+{
+	if (TheJobSystem == nullptr)
+	{
+		printf("The job system is not initialized\n");
+		return 1;
+	}
+
+	printf("Testing the job system with %d threads\n", TheJobSystem->getThreadCount());
+
+	Bool passed = true;
+	passed &= runTest("Stealing", testStealing);
+	passed &= runTest("Nested parallelFor", testNestedParallelFor);
+	passed &= runTest("Dependencies", testDependencies);
+	passed &= runTest("parallelReduce", testParallelReduce);
+	passed &= runTest("Pool contention", testPoolContention);
+
+	printf("%s\n", passed ? "All job system tests passed" : "Job system tests failed");
+	return passed ? 0 : 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Every item of the split ranges must be counted exactly once. */
+//-------------------------------------------------------------------------------------------------
+Bool JobSystemTest::testStealing()
+{
+	StealTest *test = NEW StealTest;
+	Bool passed = true;
+	std::vector<UnsignedInt> threadIds;
+
+	for (Int round = 0; round < STEAL_ROUNDS && passed; ++round)
+	{
+		memset(test, 0, sizeof(*test));
+
+		JobGroup group;
+		TheJobSystem->submit(TheJobSystem->createJob(runStealRange, test, 0, STEAL_ITEM_COUNT, &group));
+		TheJobSystem->wait(&group);
+
+		for (Int i = 0; i < STEAL_ITEM_COUNT; ++i)
+		{
+			if (test->itemCounts[i] != 1)
+			{
+				printf("Item %d ran %ld times in round %d\n", i, test->itemCounts[i], round);
+				passed = false;
+				break;
+			}
+			if (std::find(threadIds.begin(), threadIds.end(), test->itemThreadIds[i]) == threadIds.end())
+				threadIds.push_back(test->itemThreadIds[i]);
+		}
+	}
+
+	// Which threads get to steal depends on the scheduler, so this is only reported.
+	printf("Items ran on %d threads\n", (Int)threadIds.size());
+
+	delete test;
+	return passed;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Jobs of an outer parallelFor run an inner parallelFor each, which must cover its range once. */
+//-------------------------------------------------------------------------------------------------
+Bool JobSystemTest::testNestedParallelFor()
+{
+	std::vector<Int> values(NESTED_OUTER_COUNT * NESTED_INNER_COUNT, 0);
+
+	for (Int round = 0; round < NESTED_ROUNDS; ++round)
+	{
+		TheJobSystem->parallelFor(NESTED_OUTER_COUNT, 1, runNestedOuter, &values[0]);
+	}
+
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		if (values[i] != NESTED_ROUNDS)
+		{
+			printf("Item %d ran %d times instead of %d\n", (Int)i, values[i], (Int)NESTED_ROUNDS);
+			return false;
+		}
+	}
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Every job must run after the jobs it depends on. The jobs are submitted in reverse, so the
+	* dependencies alone hold them back.
+	*/
+//-------------------------------------------------------------------------------------------------
+Bool JobSystemTest::testDependencies()
+{
+	std::vector<ChainRound> rounds(CHAIN_ROUNDS);
+	std::vector<ChainStep> steps(CHAIN_ROUNDS * CHAIN_COUNT * CHAIN_LENGTH);
+	std::vector<Job *> jobs;
+	jobs.reserve(CHAIN_ROUNDS * (CHAIN_COUNT * CHAIN_LENGTH + 2));
+
+	JobGroup group;
+	for (Int r = 0; r < CHAIN_ROUNDS; ++r)
+	{
+		ChainRound &round = rounds[r];
+		memset(&round, 0, sizeof(round));
+
+		Job *start = TheJobSystem->createJob(runChainStart, &round, 0, 1, &group);
+		Job *join = TheJobSystem->createJob(runChainJoin, &round, 0, 1, &group);
+		jobs.push_back(start);
+		jobs.push_back(join);
+
+		for (Int c = 0; c < CHAIN_COUNT; ++c)
+		{
+			Job *previous = start;
+			for (Int s = 0; s < CHAIN_LENGTH; ++s)
+			{
+				ChainStep &step = steps[(r * CHAIN_COUNT + c) * CHAIN_LENGTH + s];
+				step.round = &round;
+				step.chain = c;
+				step.step = s;
+
+				Job *job = TheJobSystem->createJob(runChainStep, &step, 0, 1, &group);
+				TheJobSystem->addDependency(previous, job);
+				jobs.push_back(job);
+				previous = job;
+			}
+			TheJobSystem->addDependency(previous, join);
+		}
+	}
+
+	for (std::vector<Job *>::reverse_iterator it = jobs.rbegin(); it != jobs.rend(); ++it)
+	{
+		TheJobSystem->submit(*it);
+	}
+	TheJobSystem->wait(&group);
+
+	for (Int r = 0; r < CHAIN_ROUNDS; ++r)
+	{
+		if (!rounds[r].joined || rounds[r].errors != 0)
+		{
+			printf("Round %d ran %ld jobs out of order\n", r, rounds[r].errors);
+			return false;
+		}
+	}
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** parallelReduce must give the same bits every time, and the same as reducing the ranges one
+	* after the other on this thread.
+	*/
+//-------------------------------------------------------------------------------------------------
+Bool JobSystemTest::testParallelReduce()
+{
+	std::vector<Real> values(REDUCE_COUNT);
+	for (Int i = 0; i < REDUCE_COUNT; ++i)
+	{
+		values[i] = (Real)(i % 1000) * 0.001f + 1.0f / (Real)(i + 1);
+	}
+
+	Real expected = 0.0f;
+	for (Int begin = 0; begin < REDUCE_COUNT; begin += REDUCE_GRAIN_SIZE)
+	{
+		Real partial = 0.0f;
+		reduceSum(&values[0], begin, min(begin + REDUCE_GRAIN_SIZE, (Int)REDUCE_COUNT), &partial);
+		combineSum(nullptr, &expected, &partial);
+	}
+
+	for (Int round = 0; round < REDUCE_ROUNDS; ++round)
+	{
+		Real sum = 0.0f;
+		TheJobSystem->parallelReduce(REDUCE_COUNT, REDUCE_GRAIN_SIZE, reduceSum, combineSum, &values[0], &sum, sizeof(sum));
+		if (memcmp(&sum, &expected, sizeof(sum)) != 0)
+		{
+			printf("Sum is %.9g instead of %.9g in round %d\n", sum, expected, round);
+			return false;
+		}
+	}
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Pool blocks that are allocated and freed on many threads at once must not be handed out twice.
+	* Also reports the time per allocated and freed block, on one thread and on all threads.
+	*/
+//-------------------------------------------------------------------------------------------------
+Bool JobSystemTest::testPoolContention()
+{
+	volatile long errors = 0;
+
+	UnsignedInt startTime = timeGetTime();
+	for (Int round = 0; round < POOL_ROUNDS; ++round)
+	{
+		runPoolItems((void *)&errors, 0, POOL_ITEM_COUNT);
+	}
+	const UnsignedInt serialTime = timeGetTime() - startTime;
+
+	startTime = timeGetTime();
+	for (Int round = 0; round < POOL_ROUNDS; ++round)
+	{
+		TheJobSystem->parallelFor(POOL_ITEM_COUNT, 16, runPoolItems, (void *)&errors);
+	}
+	const UnsignedInt parallelTime = timeGetTime() - startTime;
+
+	const double blockCount = (double)POOL_ROUNDS * POOL_ITEM_COUNT * POOL_BATCH_SIZE;
+	printf("Pool blocks take %.1f ns on 1 thread and %.1f ns on %d threads\n",
+		serialTime * 1000000.0 / blockCount, parallelTime * 1000000.0 / blockCount, TheJobSystem->getThreadCount());
+
+	if (errors != 0)
+	{
+		printf("%ld pool blocks were changed by another allocation\n", errors);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,484 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/LogicProfiler.h"
+
+#include "Common/NameKeyGenerator.h"
+#include "GameLogic/ScriptEngine.h"
+
+
+Bool LogicProfiler::s_enabled = false;
+Int64 LogicProfiler::s_counters[LogicProfiler::COUNTER_COUNT];
+
+namespace
+{
+// Identifies a section independent of where it was called from.
+struct SectionKey
+{
+	Int category;
+	Int id;
+	const char *name;
+
+	// Names are compared by content because overloads share a name, but not its address.
+	bool operator==(const SectionKey &other) const
+	{
+		if (category != other.category || id != other.id)
+			return false;
+		if (name == other.name)
+			return true;
+		return name != nullptr && other.name != nullptr && strcmp(name, other.name) == 0;
+	}
+};
+
+// Identifies a section at one place in the call tree.
+struct SectionNodeKey
+{
+	Int parent;
+	SectionKey section;
+
+	bool operator==(const SectionNodeKey &other) const
+	{
+		return parent == other.parent && section == other.section;
+	}
+};
+
+struct SectionKeyHash
+{
+	size_t operator()(const SectionKey &key) const
+	{
+		const size_t nameHash = key.name != nullptr ? rts::hash<const char*>()(key.name) : 0;
+		return (size_t)key.category * 2654435761u ^ (size_t)key.id ^ nameHash;
+	}
+};
+
+struct SectionNodeKeyHash
+{
+	size_t operator()(const SectionNodeKey &key) const
+	{
+		return SectionKeyHash()(key.section) * 31 + (size_t)key.parent;
+	}
+};
+
+// Totals of a section over all the places it was called from.
+struct SectionStat
+{
+	SectionKey key;
+	Int64 ticks;
+	Int64 selfTicks;
+	Int64 frameTicks;
+	Int64 maxFrameTicks;
+	UnsignedInt calls;
+	UnsignedInt frames;
+	UnsignedInt lastFrame;
+	Int activeCount;
+};
+
+// A section at one place in the call tree.
+struct SectionNode
+{
+	Int parent;
+	Int stat;
+	Int64 ticks;
+	Int64 childTicks;
+	UnsignedInt calls;
+};
+
+typedef std::hash_map<SectionKey, Int, SectionKeyHash, rts::equal_to<SectionKey> > SectionStatIndexMap;
+typedef std::hash_map<SectionNodeKey, Int, SectionNodeKeyHash, rts::equal_to<SectionNodeKey> > SectionNodeIndexMap;
+
+std::vector<SectionStat> s_stats;
+std::vector<SectionNode> s_nodes;
+SectionStatIndexMap s_statIndices;
+SectionNodeIndexMap s_nodeIndices;
+
+std::vector<Int> s_activeNodes;
+std::vector<Int64> s_activeStartTicks;
+std::vector<Int> s_frameStats;
+std::vector<Int64> s_frameTicks;
+Int64 s_frameStartTicks = 0;
+
+UnsignedInt s_frameCount = 0;
+Bool s_inFrame = false;
+
+const char* const s_gameLogicName = "update";
+
+Int64 getTicks()
+{
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return ticks.QuadPart;
+}
+
+Int64 getTicksPerSecond()
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	return freq.QuadPart;
+}
+
+Int findOrAddStat(const SectionKey &key)
+{
+	SectionStatIndexMap::const_iterator it = s_statIndices.find(key);
+	if (it != s_statIndices.end())
+		return it->second;
+
+	SectionStat stat;
+	stat.key = key;
+	stat.ticks = 0;
+	stat.selfTicks = 0;
+	stat.frameTicks = 0;
+	stat.maxFrameTicks = 0;
+	stat.calls = 0;
+	stat.frames = 0;
+	stat.lastFrame = ~0u;
+	stat.activeCount = 0;
+
+	const Int index = (Int)s_stats.size();
+	s_stats.push_back(stat);
+	s_statIndices[key] = index;
+	return index;
+}
+
+Int findOrAddNode(Int parent, const SectionKey &key)
+{
+	SectionNodeKey nodeKey;
+	nodeKey.parent = parent;
+	nodeKey.section = key;
+
+	SectionNodeIndexMap::const_iterator it = s_nodeIndices.find(nodeKey);
+	if (it != s_nodeIndices.end())
+		return it->second;
+
+	SectionNode node;
+	node.parent = parent;
+	node.stat = findOrAddStat(key);
+	node.ticks = 0;
+	node.childTicks = 0;
+	node.calls = 0;
+
+	const Int index = (Int)s_nodes.size();
+	s_nodes.push_back(node);
+	s_nodeIndices[nodeKey] = index;
+	return index;
+}
+
+const char *getCategoryName(Int category)
+{
+	switch (category)
+	{
+		case LogicProfiler::CATEGORY_GAME_LOGIC: return "GameLogic";
+		case LogicProfiler::CATEGORY_UPDATE_MODULE: return "UpdateModule";
+		case LogicProfiler::CATEGORY_SCRIPT_ACTION: return "ScriptAction";
+		case LogicProfiler::CATEGORY_SCRIPT_CONDITION: return "ScriptCondition";
+		case LogicProfiler::CATEGORY_PATHFINDER: return "Pathfinder";
+		case LogicProfiler::CATEGORY_PARTITION_MANAGER: return "PartitionManager";
+	}
+	return "Unknown";
+}
+
+AsciiString getSectionName(const SectionKey &key)
+{
+	if (key.name != nullptr)
+		return key.name;
+
+	AsciiString name;
+	switch (key.category)
+	{
+		case LogicProfiler::CATEGORY_UPDATE_MODULE:
+			if (TheNameKeyGenerator)
+				name = TheNameKeyGenerator->keyToName((NameKeyType)key.id);
+			break;
+		case LogicProfiler::CATEGORY_SCRIPT_ACTION:
+			if (TheScriptEngine)
+				name = TheScriptEngine->getActionTemplate(key.id)->m_internalName;
+			break;
+		case LogicProfiler::CATEGORY_SCRIPT_CONDITION:
+			if (TheScriptEngine)
+				name = TheScriptEngine->getConditionTemplate(key.id)->m_internalName;
+			break;
+	}
+	if (name.isEmpty())
+		name.format("%d", key.id);
+	return name;
+}
+
+// Flamegraph tools split frames at ';' and the count at the last ' '.
+AsciiString getFoldedFrameName(const SectionKey &key)
+{
+	const AsciiString name = getSectionName(key);
+	AsciiString frame = getCategoryName(key.category);
+	frame.concat("::");
+	for (const char *c = name.str(); *c; ++c)
+	{
+		frame.concat((*c == ';' || *c == ' ') ? '_' : *c);
+	}
+	return frame;
+}
+
+void writeJsonString(FILE *fp, const char *str)
+{
+	fputc('"', fp);
+	for (; *str; ++str)
+	{
+		if (*str == '"' || *str == '\\')
+			fputc('\\', fp);
+		if ((unsigned char)*str >= 0x20)
+			fputc(*str, fp);
+	}
+	fputc('"', fp);
+}
+
+const char *getCounterName(Int counter)
+{
+	switch (counter)
+	{
+		case LogicProfiler::COUNTER_PATHFIND_CELLS_EXPANDED: return "pathfindCellsExpanded";
+	}
+	return "unknown";
+}
+
+// Nearest rank percentile of sorted values.
+Int64 getPercentile(const std::vector<Int64> &sortedValues, Int percent)
+{
+	if (sortedValues.empty())
+		return 0;
+	size_t rank = (sortedValues.size() * percent + 99) / 100;
+	if (rank > 0)
+		--rank;
+	return sortedValues[rank];
+}
+
+struct SectionStatTicksGreater
+{
+	bool operator()(Int a, Int b) const
+	{
+		if (s_stats[a].ticks != s_stats[b].ticks)
+			return s_stats[a].ticks > s_stats[b].ticks;
+		return a < b;
+	}
+};
+
+} // namespace
+
+void LogicProfiler::setEnabled(Bool enabled)
+{
+	s_enabled = enabled;
+}
+
+void LogicProfiler::reset()
+{
+	DEBUG_ASSERTCRASH(s_activeNodes.empty(), ("LogicProfiler::reset - sections are still active"));
+
+	s_stats.clear();
+	s_nodes.clear();
+	s_statIndices.clear();
+	s_nodeIndices.clear();
+	s_activeNodes.clear();
+	s_activeStartTicks.clear();
+	s_frameStats.clear();
+	s_frameTicks.clear();
+	s_frameCount = 0;
+	s_inFrame = false;
+
+	for (Int i = 0; i < COUNTER_COUNT; ++i)
+		s_counters[i] = 0;
+}
+
+void LogicProfiler::beginFrame()
+{
+	DEBUG_ASSERTCRASH(!s_inFrame, ("LogicProfiler::beginFrame - frame already begun"));
+	s_inFrame = true;
+	beginSection(CATEGORY_GAME_LOGIC, 0, s_gameLogicName);
+	s_frameStartTicks = getTicks();
+}
+
+void LogicProfiler::endFrame()
+{
+	if (!s_inFrame)
+		return;
+
+	s_frameTicks.push_back(getTicks() - s_frameStartTicks);
+	endSection();
+	s_inFrame = false;
+
+	for (size_t i = 0; i < s_frameStats.size(); ++i)
+	{
+		SectionStat &stat = s_stats[s_frameStats[i]];
+		if (stat.frameTicks > stat.maxFrameTicks)
+			stat.maxFrameTicks = stat.frameTicks;
+		stat.frameTicks = 0;
+		++stat.frames;
+	}
+	s_frameStats.clear();
+	++s_frameCount;
+}
+
+void LogicProfiler::beginSection(Category category, Int id, const char *name)
+{
+	SectionKey key;
+	key.category = category;
+	key.id = id;
+	key.name = name;
+
+	const Int parent = s_activeNodes.empty() ? -1 : s_activeNodes.back();
+	const Int node = findOrAddNode(parent, key);
+
+	SectionStat &stat = s_stats[s_nodes[node].stat];
+	++stat.activeCount;
+	if (stat.lastFrame != s_frameCount)
+	{
+		stat.lastFrame = s_frameCount;
+		s_frameStats.push_back(s_nodes[node].stat);
+	}
+
+	s_activeNodes.push_back(node);
+	s_activeStartTicks.push_back(getTicks());
+}
+
+void LogicProfiler::endSection()
+{
+	if (s_activeNodes.empty())
+		return;
+
+	const Int64 ticks = getTicks() - s_activeStartTicks.back();
+	const Int nodeIndex = s_activeNodes.back();
+	s_activeNodes.pop_back();
+	s_activeStartTicks.pop_back();
+
+	SectionNode &node = s_nodes[nodeIndex];
+	node.ticks += ticks;
+	++node.calls;
+	if (node.parent >= 0)
+		s_nodes[node.parent].childTicks += ticks;
+
+	// Recursive calls are already contained in the time of the outermost call.
+	SectionStat &stat = s_stats[node.stat];
+	++stat.calls;
+	if (--stat.activeCount == 0)
+	{
+		stat.ticks += ticks;
+		stat.frameTicks += ticks;
+	}
+}
+
+Bool LogicProfiler::writeReport(const AsciiString &basename)
+{
+	const double ticksPerMs = (double)getTicksPerSecond() / 1000.0;
+	const double ticksPerUs = ticksPerMs / 1000.0;
+
+	// Self time excludes the time of nested sections.
+	size_t i;
+	for (i = 0; i < s_stats.size(); ++i)
+		s_stats[i].selfTicks = 0;
+	for (i = 0; i < s_nodes.size(); ++i)
+	{
+		const Int64 selfTicks = s_nodes[i].ticks - s_nodes[i].childTicks;
+		s_stats[s_nodes[i].stat].selfTicks += selfTicks > 0 ? selfTicks : 0;
+	}
+
+	std::vector<Int> order;
+	order.reserve(s_stats.size());
+	for (i = 0; i < s_stats.size(); ++i)
+		order.push_back((Int)i);
+	std::sort(order.begin(), order.end(), SectionStatTicksGreater());
+
+	Int64 frameTicks = 0;
+	for (i = 0; i < s_stats.size(); ++i)
+	{
+		if (s_stats[i].key.category == CATEGORY_GAME_LOGIC)
+			frameTicks += s_stats[i].ticks;
+	}
+
+	AsciiString jsonFilename;
+	jsonFilename.format("%s.json", basename.str());
+	FILE *fp = fopen(jsonFilename.str(), "w");
+	if (fp == nullptr)
+		return false;
+
+	std::vector<Int64> sortedFrameTicks(s_frameTicks);
+	std::sort(sortedFrameTicks.begin(), sortedFrameTicks.end());
+
+	const UnsignedInt frames = s_frameCount > 0 ? s_frameCount : 1;
+	const double logicFps = frameTicks > 0 ? s_frameCount * 1000.0 * ticksPerMs / frameTicks : 0.0;
+	fprintf(fp, "{\n");
+	fprintf(fp, "\t\"frames\": %u,\n", s_frameCount);
+	fprintf(fp, "\t\"totalMs\": %.3f,\n", frameTicks / ticksPerMs);
+	fprintf(fp, "\t\"logicFps\": %.1f,\n", logicFps);
+	fprintf(fp, "\t\"frameMsP50\": %.4f,\n", getPercentile(sortedFrameTicks, 50) / ticksPerMs);
+	fprintf(fp, "\t\"frameMsP99\": %.4f,\n", getPercentile(sortedFrameTicks, 99) / ticksPerMs);
+	fprintf(fp, "\t\"frameMsMax\": %.4f,\n", (sortedFrameTicks.empty() ? 0 : sortedFrameTicks.back()) / ticksPerMs);
+	fprintf(fp, "\t\"peakPoolBytes\": %d,\n", TheMemoryPoolFactory ? TheMemoryPoolFactory->getPeakPoolBytes() : 0);
+	fprintf(fp, "\t\"counters\": {");
+	for (i = 0; i < (size_t)COUNTER_COUNT; ++i)
+	{
+		fprintf(fp, i == 0 ? " " : ", ");
+		writeJsonString(fp, getCounterName((Int)i));
+		fprintf(fp, ": %I64d", s_counters[i]);
+	}
+	fprintf(fp, " },\n");
+	fprintf(fp, "\t\"sections\": [");
+	for (i = 0; i < order.size(); ++i)
+	{
+		const SectionStat &stat = s_stats[order[i]];
+		fprintf(fp, i == 0 ? "\n" : ",\n");
+		fprintf(fp, "\t\t{ \"category\": ");
+		writeJsonString(fp, getCategoryName(stat.key.category));
+		fprintf(fp, ", \"name\": ");
+		writeJsonString(fp, getSectionName(stat.key).str());
+		fprintf(fp, ", \"calls\": %u, \"frames\": %u, \"totalMs\": %.3f, \"selfMs\": %.3f, \"msPerFrame\": %.4f, \"maxFrameMs\": %.3f }",
+			stat.calls,
+			stat.frames,
+			stat.ticks / ticksPerMs,
+			stat.selfTicks / ticksPerMs,
+			stat.ticks / ticksPerMs / frames,
+			stat.maxFrameTicks / ticksPerMs);
+	}
+	fprintf(fp, "\n\t]\n}\n");
+	const Bool jsonWritten = ferror(fp) == 0;
+	fclose(fp);
+
+	AsciiString foldedFilename;
+	foldedFilename.format("%s.folded", basename.str());
+	fp = fopen(foldedFilename.str(), "w");
+	if (fp == nullptr)
+		return false;
+
+	// One line per call tree node with its self time in microseconds.
+	std::vector<AsciiString> stacks(s_nodes.size());
+	for (i = 0; i < s_nodes.size(); ++i)
+	{
+		// Parents are always created before their children.
+		const SectionNode &node = s_nodes[i];
+		const AsciiString frame = getFoldedFrameName(s_stats[node.stat].key);
+		if (node.parent >= 0)
+			stacks[i].format("%s;%s", stacks[node.parent].str(), frame.str());
+		else
+			stacks[i] = frame;
+
+		const Int64 selfTicks = node.ticks - node.childTicks;
+		const UnsignedInt selfUs = selfTicks > 0 ? (UnsignedInt)(selfTicks / ticksPerUs) : 0;
+		if (selfUs > 0)
+			fprintf(fp, "%s %u\n", stacks[i].str(), selfUs);
+	}
+	const Bool foldedWritten = ferror(fp) == 0;
+	fclose(fp);
+
+	return jsonWritten && foldedWritten;
+}
@@ -872,3 +872,29 @@ Bool OptionPreferences::getShowMoneyPerMinute() const
 	}
 	return FALSE;
 }
+
+Bool OptionPreferences::getCompressSaveGames() const
+{
+	OptionPreferences::const_iterator it = find("CompressSaveGames");
+	if (it == end())
+		return TheGlobalData->m_compressSaveGames;
+
+	if (stricmp(it->second.str(), "yes") == 0)
+	{
+		return TRUE;
+	}
+	return FALSE;
+}
+
+Bool OptionPreferences::getIncrementalSaveGames() const
+{
+	OptionPreferences::const_iterator it = find("IncrementalSaveGames");
+	if (it == end())
+		return TheGlobalData->m_incrementalSaveGames;
+
+	if (stricmp(it->second.str(), "yes") == 0)
+	{
+		return TRUE;
+	}
+	return FALSE;
+}
@@ -76,6 +76,16 @@ UnsignedInt GetGameLogicRandomSeedCRC()
 	return c.get();
 }
 
+void GetGameLogicRandomState( UnsignedInt state[6] )
+{
+	memcpy(state, theGameLogicSeed, sizeof(theGameLogicSeed));
+}
+
+void SetGameLogicRandomState( const UnsignedInt state[6] )
+{
+	memcpy(theGameLogicSeed, state, sizeof(theGameLogicSeed));
+}
+
 static void seedRandom(UnsignedInt SEED, UnsignedInt (&seed)[6])
 {
 	UnsignedInt ax;
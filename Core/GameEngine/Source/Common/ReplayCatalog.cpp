@@ -0,0 +1,259 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/ReplayCatalog.h"
+
+#include "Common/file.h"
+#include "Common/FileSystem.h"
+#include "Common/INI.h"
+#include "Common/JobSystem.h"
+#include "Common/LocalFileSystem.h"
+#include "Common/QuotedPrintable.h"
+
+
+ReplayCatalog *TheReplayCatalog = nullptr;
+
+const char *const ReplayCatalog::m_catalogName = "ReplayCatalog.ini";
+
+namespace
+{
+struct ReadReplayHeadersData
+{
+	ReplayCatalogEntry **entries;
+	const char *replayDir;
+};
+
+// Runs on any thread, so it only uses strings of its own entries. Opening, reading and closing a
+// file of TheLocalFileSystem is safe from any thread, because the file objects come from the locked
+// memory pools and the open file count is atomic. TheFileSystem is not safe, because it also looks
+// up files in the archives, and neither is opening files for writing, which creates directories.
+void readReplayHeaders(void *data, Int begin, Int end)
+{
+	const ReadReplayHeadersData *headersData = static_cast<const ReadReplayHeadersData *>(data);
+	for (Int i = begin; i < end; ++i)
+	{
+		ReplayCatalogEntry &entry = *headersData->entries[i];
+		entry.m_isValid = FALSE;
+
+		AsciiString filepath;
+		filepath.format("%s%s", headersData->replayDir, entry.m_header.filename.str());
+		File *file = TheLocalFileSystem->openFile(filepath.str(), File::READ | File::BINARY);
+		if (file == nullptr)
+			continue;
+
+		if (RecorderClass::readReplayHeaderFields(file, entry.m_header))
+		{
+			entry.m_isValid = entry.m_header.localPlayerIndex >= -1 && entry.m_header.localPlayerIndex < MAX_SLOTS;
+		}
+		file->close();
+	}
+}
+} // namespace
+
+void ReplayCatalog::updateCatalog()
+{
+	if (m_doLoadCatalogINI)
+	{
+		loadCatalogINI();
+		m_doLoadCatalogINI = FALSE;
+	}
+
+	if (loadReplaysFromDisk())
+	{
+		writeCatalogINI();
+	}
+}
+
+Int ReplayCatalog::rebuildCatalog()
+{
+	clear();
+	m_doLoadCatalogINI = FALSE;
+
+	loadReplaysFromDisk();
+	writeCatalogINI();
+
+	Int validReplays = 0;
+	for (const_iterator it = begin(); it != end(); ++it)
+	{
+		if (it->second.m_isValid)
+			++validReplays;
+	}
+	return validReplays;
+}
+
+const ReplayCatalogEntry *ReplayCatalog::findReplay( const AsciiString &filename ) const
+{
+	AsciiString lowerFilename = filename;
+	lowerFilename.toLower();
+
+	const_iterator it = find(lowerFilename);
+	if (it == end() || !it->second.m_isValid || !it->second.m_doesExist)
+		return nullptr;
+	return &it->second;
+}
+
+void ReplayCatalog::loadCatalogINI()
+{
+	INI ini;
+	AsciiString fname = RecorderClass::getReplayDir();
+	fname.concat(m_catalogName);
+
+	if (TheFileSystem->doesFileExist(fname.str()))
+	{
+		ini.load( fname, INI_LOAD_OVERWRITE, nullptr );
+	}
+}
+
+void ReplayCatalog::writeCatalogINI()
+{
+	const AsciiString replayDir = RecorderClass::getReplayDir();
+	TheFileSystem->createDirectory(replayDir);
+
+	AsciiString filepath = replayDir;
+	filepath.concat(m_catalogName);
+	FILE *fp = fopen(filepath.str(), "w");
+	DEBUG_ASSERTCRASH(fp != nullptr, ("Failed to create %s", filepath.str()));
+	if (fp == nullptr) {
+		return;
+	}
+
+	fprintf(fp, "; FILE: %s /////////////////////////////////////////////////////////////\n", filepath.str());
+	fprintf(fp, "; This INI file is auto-generated - do not modify\n");
+	fprintf(fp, "; /////////////////////////////////////////////////////////////////////////////\n");
+
+	for (const_iterator it = begin(); it != end(); ++it)
+	{
+		const ReplayCatalogEntry &entry = it->second;
+		const RecorderClass::ReplayHeader &header = entry.m_header;
+		fprintf(fp, "\nReplayCatalog %s\n", AsciiStringToQuotedPrintable(header.filename).str());
+		fprintf(fp, "  fileSize = %u\n", entry.m_filesize);
+		fprintf(fp, "  timestampLo = %u\n", entry.m_timestampLow);
+		fprintf(fp, "  timestampHi = %u\n", entry.m_timestampHigh);
+		fprintf(fp, "  isValid = %s\n", entry.m_isValid ? "yes" : "no");
+
+		if (entry.m_isValid)
+		{
+			UnsignedInt playerDiscons = 0;
+			for (Int i = 0; i < MAX_SLOTS; ++i)
+			{
+				if (header.playerDiscons[i])
+					playerDiscons |= 1 << i;
+			}
+
+			const SYSTEMTIME &time = header.timeVal;
+			fprintf(fp, "  replayName = %s\n", UnicodeStringToQuotedPrintable(header.replayName).str());
+			fprintf(fp, "  date = %u %u %u %u %u %u %u %u\n", time.wYear, time.wMonth, time.wDayOfWeek, time.wDay,
+				time.wHour, time.wMinute, time.wSecond, time.wMilliseconds);
+			fprintf(fp, "  versionString = %s\n", UnicodeStringToQuotedPrintable(header.versionString).str());
+			fprintf(fp, "  versionTimeString = %s\n", UnicodeStringToQuotedPrintable(header.versionTimeString).str());
+			fprintf(fp, "  versionNumber = %u\n", header.versionNumber);
+			fprintf(fp, "  exeCRC = %u\n", header.exeCRC);
+			fprintf(fp, "  iniCRC = %u\n", header.iniCRC);
+			fprintf(fp, "  startTime = %d\n", (Int)header.startTime);
+			fprintf(fp, "  endTime = %d\n", (Int)header.endTime);
+			fprintf(fp, "  frameCount = %u\n", header.frameCount);
+			fprintf(fp, "  quitEarly = %s\n", header.quitEarly ? "yes" : "no");
+			fprintf(fp, "  desyncGame = %s\n", header.desyncGame ? "yes" : "no");
+			fprintf(fp, "  playerDiscons = %u\n", playerDiscons);
+			fprintf(fp, "  gameOptions = %s\n", AsciiStringToQuotedPrintable(header.gameOptions).str());
+			fprintf(fp, "  localPlayerIndex = %d\n", header.localPlayerIndex);
+		}
+		fprintf(fp, "END\n\n");
+	}
+
+	fclose(fp);
+}
+
+Bool ReplayCatalog::loadReplaysFromDisk()
+{
+	iterator it;
+	for (it = begin(); it != end(); ++it)
+	{
+		it->second.m_doesExist = FALSE;
+	}
+
+	const AsciiString replayDir = RecorderClass::getReplayDir();
+	AsciiString pattern = "*";
+	pattern.concat(RecorderClass::getReplayExtention());
+
+	FilenameList filepathList;
+	TheFileSystem->getFileListInDirectory(replayDir, pattern, filepathList, FALSE);
+
+	std::vector<ReplayCatalogEntry *> changedEntries;
+	for (FilenameListIter filepathIt = filepathList.begin(); filepathIt != filepathList.end(); ++filepathIt)
+	{
+		FileInfo fileInfo;
+		if (!TheFileSystem->getFileInfo(*filepathIt, &fileInfo))
+			continue;
+
+		AsciiString filename;
+		filename.set(filepathIt->reverseFind('\\') + 1);
+		AsciiString lowerFilename = filename;
+		lowerFilename.toLower();
+
+		ReplayCatalogEntry &entry = (*this)[lowerFilename];
+		entry.m_doesExist = TRUE;
+
+		if (entry.m_header.filename == filename
+			&& entry.m_filesize == (UnsignedInt)fileInfo.sizeLow
+			&& entry.m_timestampLow == (UnsignedInt)fileInfo.timestampLow
+			&& entry.m_timestampHigh == (UnsignedInt)fileInfo.timestampHigh)
+		{
+			continue;
+		}
+
+		entry.m_header.filename = filename;
+		entry.m_header.forPlayback = FALSE;
+		entry.m_filesize = fileInfo.sizeLow;
+		entry.m_timestampLow = fileInfo.timestampLow;
+		entry.m_timestampHigh = fileInfo.timestampHigh;
+		changedEntries.push_back(&entry);
+	}
+
+	// The headers are independent of each other, so they are read in parallel.
+	if (!changedEntries.empty())
+	{
+		DEBUG_LOG(("ReplayCatalog::loadReplaysFromDisk - reading %d replay headers", (Int)changedEntries.size()));
+
+		ReadReplayHeadersData data;
+		data.entries = &changedEntries[0];
+		data.replayDir = replayDir.str();
+		if (TheJobSystem != nullptr)
+			TheJobSystem->parallelFor((Int)changedEntries.size(), 0, readReplayHeaders, &data);
+		else
+			readReplayHeaders(&data, 0, (Int)changedEntries.size());
+	}
+
+	Bool erasedSomething = FALSE;
+	it = begin();
+	while (it != end())
+	{
+		iterator next = it;
+		++next;
+		if (!it->second.m_doesExist)
+		{
+			erase(it);
+			erasedSomething = TRUE;
+		}
+		it = next;
+	}
+
+	return !changedEntries.empty() || erasedSomething;
+}
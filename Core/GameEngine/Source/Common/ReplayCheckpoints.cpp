@@ -0,0 +1,273 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/ReplayCheckpoints.h"
+
+#include "Common/file.h"
+#include "Common/FileSystem.h"
+#include "Compression.h"
+
+// File layout:
+//   header: magic, version, replay key, exe CRC, ini CRC
+//   checkpoints: frame, logic CRC, playback state size, compressed game state size, playback state, compressed game state
+//   index: frame and file offset of every checkpoint
+//   footer: checkpoint count, index offset, magic
+constexpr const char s_checkpointMagic[] = "GENCKP";
+constexpr const UnsignedInt s_checkpointVersion = 1;
+constexpr const Int s_magicSize = sizeof(s_checkpointMagic) - 1;
+constexpr const Int s_footerSize = sizeof(UnsignedInt) + sizeof(Int) + s_magicSize;
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+ReplayCheckpointWriter::ReplayCheckpointWriter() : m_file(nullptr)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+ReplayCheckpointWriter::~ReplayCheckpointWriter()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Bool ReplayCheckpointWriter::open( const AsciiString &filepath, UnsignedInt replayKey )
+{
+	close();
+
+	m_file = TheFileSystem->openFile(filepath.str(), File::WRITE | File::BINARY);
+	if (m_file == nullptr)
+	{
+		DEBUG_LOG(("ReplayCheckpointWriter::open - Can't open %s", filepath.str()));
+		return FALSE;
+	}
+
+	m_file->write(s_checkpointMagic, s_magicSize);
+	m_file->write(&s_checkpointVersion, sizeof(s_checkpointVersion));
+	m_file->write(&replayKey, sizeof(replayKey));
+	m_file->write(&TheGlobalData->m_exeCRC, sizeof(TheGlobalData->m_exeCRC));
+	m_file->write(&TheGlobalData->m_iniCRC, sizeof(TheGlobalData->m_iniCRC));
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Bool ReplayCheckpointWriter::write( const ReplayCheckpoint &checkpoint )
+{
+	if (m_file == nullptr || checkpoint.gameState.empty())
+		return FALSE;
+
+	if (!m_index.empty() && checkpoint.frame <= m_index.back().frame)
+	{
+		DEBUG_CRASH(("ReplayCheckpointWriter::write - Checkpoint for frame %u is not after frame %u", checkpoint.frame, m_index.back().frame));
+		return FALSE;
+	}
+
+	const CompressionType compressionType = CompressionManager::getPreferredCompression();
+	const Int gameStateSize = (Int)checkpoint.gameState.size();
+	m_compressBuffer.resize(CompressionManager::getMaxCompressedSize(gameStateSize, compressionType));
+	const Int compressedSize = CompressionManager::compressData(compressionType, (void *)&checkpoint.gameState[0], gameStateSize,
+		&m_compressBuffer[0], (Int)m_compressBuffer.size());
+	if (compressedSize == 0)
+	{
+		DEBUG_LOG(("ReplayCheckpointWriter::write - Compression of frame %u failed", checkpoint.frame));
+		return FALSE;
+	}
+
+	ReplayCheckpointIndexEntry entry;
+	entry.frame = checkpoint.frame;
+	entry.fileOffset = m_file->position();
+
+	const Int playbackStateSize = (Int)checkpoint.playbackState.size();
+	m_file->write(&checkpoint.frame, sizeof(checkpoint.frame));
+	m_file->write(&checkpoint.logicCRC, sizeof(checkpoint.logicCRC));
+	m_file->write(&playbackStateSize, sizeof(playbackStateSize));
+	m_file->write(&compressedSize, sizeof(compressedSize));
+	if (playbackStateSize > 0)
+		m_file->write(&checkpoint.playbackState[0], playbackStateSize);
+	if (m_file->write(&m_compressBuffer[0], compressedSize) != compressedSize)
+	{
+		DEBUG_LOG(("ReplayCheckpointWriter::write - Write of frame %u failed", checkpoint.frame));
+		return FALSE;
+	}
+
+	m_index.push_back(entry);
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void ReplayCheckpointWriter::close()
+{
+	if (m_file == nullptr)
+		return;
+
+	const Int indexOffset = m_file->position();
+	const UnsignedInt count = (UnsignedInt)m_index.size();
+	for (UnsignedInt i = 0; i < count; ++i)
+	{
+		m_file->write(&m_index[i].frame, sizeof(m_index[i].frame));
+		m_file->write(&m_index[i].fileOffset, sizeof(m_index[i].fileOffset));
+	}
+	m_file->write(&count, sizeof(count));
+	m_file->write(&indexOffset, sizeof(indexOffset));
+	m_file->write(s_checkpointMagic, s_magicSize);
+
+	m_file->close();
+	m_file = nullptr;
+	m_index.clear();
+	m_compressBuffer.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+ReplayCheckpointReader::ReplayCheckpointReader() : m_file(nullptr)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+ReplayCheckpointReader::~ReplayCheckpointReader()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Bool ReplayCheckpointReader::open( const AsciiString &filepath, UnsignedInt replayKey )
+{
+	close();
+
+	m_file = TheFileSystem->openFile(filepath.str(), File::READ | File::BINARY);
+	if (m_file == nullptr)
+		return FALSE;
+
+	char magic[s_magicSize];
+	UnsignedInt version = 0;
+	UnsignedInt fileReplayKey = 0;
+	UnsignedInt exeCRC = 0;
+	UnsignedInt iniCRC = 0;
+	m_file->read(magic, s_magicSize);
+	m_file->read(&version, sizeof(version));
+	m_file->read(&fileReplayKey, sizeof(fileReplayKey));
+	m_file->read(&exeCRC, sizeof(exeCRC));
+	if (m_file->read(&iniCRC, sizeof(iniCRC)) != sizeof(iniCRC)
+		|| strncmp(magic, s_checkpointMagic, s_magicSize) != 0
+		|| version != s_checkpointVersion)
+	{
+		DEBUG_LOG(("ReplayCheckpointReader::open - %s is not a replay checkpoint file", filepath.str()));
+		close();
+		return FALSE;
+	}
+
+	if (fileReplayKey != replayKey || exeCRC != TheGlobalData->m_exeCRC || iniCRC != TheGlobalData->m_iniCRC)
+	{
+		DEBUG_LOG(("ReplayCheckpointReader::open - %s was written for another replay or game version", filepath.str()));
+		close();
+		return FALSE;
+	}
+
+	// read the footer, which is missing when the writer was not closed
+	const Int fileSize = m_file->size();
+	UnsignedInt count = 0;
+	Int indexOffset = 0;
+	m_file->seek(fileSize - s_footerSize, File::START);
+	m_file->read(&count, sizeof(count));
+	m_file->read(&indexOffset, sizeof(indexOffset));
+	const Int magicSize = m_file->read(magic, s_magicSize);
+	const Int indexSize = fileSize - s_footerSize - indexOffset;
+	if (magicSize != s_magicSize || strncmp(magic, s_checkpointMagic, s_magicSize) != 0
+		|| indexSize < 0 || indexSize != (Int)(count * (sizeof(UnsignedInt) + sizeof(Int))))
+	{
+		DEBUG_LOG(("ReplayCheckpointReader::open - %s is incomplete", filepath.str()));
+		close();
+		return FALSE;
+	}
+
+	m_file->seek(indexOffset, File::START);
+	m_index.resize(count);
+	for (UnsignedInt i = 0; i < count; ++i)
+	{
+		m_file->read(&m_index[i].frame, sizeof(m_index[i].frame));
+		m_file->read(&m_index[i].fileOffset, sizeof(m_index[i].fileOffset));
+	}
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void ReplayCheckpointReader::close()
+{
+	if (m_file != nullptr)
+	{
+		m_file->close();
+		m_file = nullptr;
+	}
+	m_index.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Bool ReplayCheckpointReader::read( UnsignedInt frame, ReplayCheckpoint &checkpoint )
+{
+	if (m_file == nullptr)
+		return FALSE;
+
+	// the index is sorted by frame
+	Int found = -1;
+	for (Int i = 0; i < (Int)m_index.size() && m_index[i].frame <= frame; ++i)
+		found = i;
+	if (found < 0)
+		return FALSE;
+
+	Int playbackStateSize = 0;
+	Int compressedSize = 0;
+	m_file->seek(m_index[found].fileOffset, File::START);
+	m_file->read(&checkpoint.frame, sizeof(checkpoint.frame));
+	m_file->read(&checkpoint.logicCRC, sizeof(checkpoint.logicCRC));
+	m_file->read(&playbackStateSize, sizeof(playbackStateSize));
+	m_file->read(&compressedSize, sizeof(compressedSize));
+	if (checkpoint.frame != m_index[found].frame || playbackStateSize < 0 || compressedSize <= 0)
+	{
+		DEBUG_CRASH(("ReplayCheckpointReader::read - Checkpoint for frame %u is corrupt", m_index[found].frame));
+		return FALSE;
+	}
+
+	checkpoint.playbackState.resize(playbackStateSize);
+	if (playbackStateSize > 0 && m_file->read(&checkpoint.playbackState[0], playbackStateSize) != playbackStateSize)
+		return FALSE;
+
+	std::vector<UnsignedByte> compressed(compressedSize);
+	if (m_file->read(&compressed[0], compressedSize) != compressedSize)
+		return FALSE;
+
+	const Int gameStateSize = CompressionManager::getUncompressedSize(&compressed[0], compressedSize);
+	checkpoint.gameState.resize(gameStateSize);
+	if (gameStateSize <= 0
+		|| CompressionManager::decompressData(&compressed[0], compressedSize, &checkpoint.gameState[0], gameStateSize) != gameStateSize)
+	{
+		DEBUG_CRASH(("ReplayCheckpointReader::read - Checkpoint for frame %u does not decompress", checkpoint.frame));
+		return FALSE;
+	}
+
+	return TRUE;
+}
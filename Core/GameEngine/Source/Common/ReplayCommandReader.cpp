@@ -0,0 +1,359 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/ReplayCommandReader.h"
+
+#include "Common/file.h"
+
+#include "thread.h"
+
+
+namespace
+{
+// Size of an argument in the replay file. Unknown types have no data.
+Int getArgumentSize(GameMessageArgumentDataType type)
+{
+	switch (type)
+	{
+		case ARGUMENTDATATYPE_INTEGER: return sizeof(Int);
+		case ARGUMENTDATATYPE_REAL: return sizeof(Real);
+		case ARGUMENTDATATYPE_BOOLEAN: return sizeof(Bool);
+		case ARGUMENTDATATYPE_OBJECTID: return sizeof(ObjectID);
+		case ARGUMENTDATATYPE_DRAWABLEID: return sizeof(DrawableID);
+		case ARGUMENTDATATYPE_TEAMID: return sizeof(UnsignedInt);
+		case ARGUMENTDATATYPE_LOCATION: return sizeof(Coord3D);
+		case ARGUMENTDATATYPE_PIXEL: return sizeof(ICoord2D);
+		case ARGUMENTDATATYPE_PIXELREGION: return sizeof(IRegion2D);
+		case ARGUMENTDATATYPE_TIMESTAMP: return sizeof(UnsignedInt);
+		case ARGUMENTDATATYPE_WIDECHAR: return sizeof(WideChar);
+	}
+	return 0;
+}
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+class ReplayCommandDecodeThread : public ThreadClass
+{
+public:
+
+	ReplayCommandDecodeThread(ReplayCommandReader *reader)
+		: ThreadClass("ReplayCommandDecodeThread")
+		, m_reader(reader)
+	{
+	}
+
+	virtual void Thread_Function() override
+	{
+		m_reader->decodeLoop();
+	}
+
+private:
+
+	ReplayCommandReader *m_reader;
+};
+
+//-------------------------------------------------------------------------------------------------
+ReplayCommandReader::ReplayCommandReader()
+	: m_file(nullptr)
+	, m_readAhead(FALSE)
+	, m_readBufferPosition(0)
+	, m_readOffset(0)
+	, m_readEnd(0)
+	, m_endOfFile(FALSE)
+	, m_currentChunk(0)
+	, m_currentCommand(0)
+	, m_hasCurrentChunk(FALSE)
+	, m_thread(nullptr)
+	, m_freeChunks(nullptr)
+	, m_filledChunks(nullptr)
+	, m_quit(FALSE)
+{
+	for (Int i = 0; i < CHUNK_COUNT; ++i)
+	{
+		m_chunks[i].commands.reserve(CHUNK_COMMANDS);
+		m_chunks[i].endOfFile = FALSE;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+ReplayCommandReader::~ReplayCommandReader()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::open( File *file, Bool readAhead )
+{
+	close();
+	m_file = file;
+	if (m_file != nullptr)
+		start(readAhead);
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::close()
+{
+	stop();
+	m_file = nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::seek( Int position )
+{
+	if (m_file == nullptr)
+		return;
+
+	const Bool readAhead = m_readAhead;
+	stop();
+	m_file->seek(position, File::START);
+	start(readAhead);
+}
+
+//-------------------------------------------------------------------------------------------------
+const ReplayCommand *ReplayCommandReader::next()
+{
+	if (m_file == nullptr)
+		return nullptr;
+
+	for (;;)
+	{
+		if (!m_hasCurrentChunk)
+		{
+			if (m_readAhead)
+				WaitForSingleObject((HANDLE)m_filledChunks, INFINITE);
+			else
+				decodeChunk(m_chunks[m_currentChunk]);
+			m_hasCurrentChunk = TRUE;
+			m_currentCommand = 0;
+		}
+
+		Chunk &chunk = m_chunks[m_currentChunk];
+		if (m_currentCommand < (Int)chunk.commands.size())
+			return &chunk.commands[m_currentCommand++];
+
+		if (chunk.endOfFile)
+			return nullptr;
+
+		// Hand the consumed chunk back to the decoder
+		m_hasCurrentChunk = FALSE;
+		if (m_readAhead)
+			ReleaseSemaphore((HANDLE)m_freeChunks, 1, nullptr);
+		m_currentChunk = (m_currentChunk + 1) % CHUNK_COUNT;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+const ReplayCommandArgument *ReplayCommandReader::getArguments( const ReplayCommand *command ) const
+{
+	if (command->argumentCount == 0)
+		return nullptr;
+	return &m_chunks[m_currentChunk].arguments[command->firstArgument];
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::start( Bool readAhead )
+{
+	m_readAhead = readAhead;
+	m_readBufferPosition = m_file->position();
+	m_readOffset = 0;
+	m_readEnd = 0;
+	m_endOfFile = FALSE;
+	m_currentChunk = 0;
+	m_currentCommand = 0;
+	m_hasCurrentChunk = FALSE;
+	m_quit = FALSE;
+
+	if (m_readAhead)
+	{
+		m_freeChunks = CreateSemaphore(nullptr, CHUNK_COUNT, CHUNK_COUNT, nullptr);
+		m_filledChunks = CreateSemaphore(nullptr, 0, CHUNK_COUNT, nullptr);
+		m_thread = NEW ReplayCommandDecodeThread(this);
+		m_thread->Execute();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::stop()
+{
+	if (m_thread != nullptr)
+	{
+		// A release fails when the semaphore is already full, which does not block the thread either.
+		m_quit = TRUE;
+		ReleaseSemaphore((HANDLE)m_freeChunks, 1, nullptr);
+
+		// Waits for the thread to exit.
+		delete m_thread;
+		m_thread = nullptr;
+	}
+
+	if (m_freeChunks != nullptr)
+	{
+		CloseHandle((HANDLE)m_freeChunks);
+		m_freeChunks = nullptr;
+	}
+	if (m_filledChunks != nullptr)
+	{
+		CloseHandle((HANDLE)m_filledChunks);
+		m_filledChunks = nullptr;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::decodeLoop()
+{
+	Int chunkIndex = 0;
+	for (;;)
+	{
+		WaitForSingleObject((HANDLE)m_freeChunks, INFINITE);
+		if (m_quit)
+			return;
+
+		Chunk &chunk = m_chunks[chunkIndex];
+		decodeChunk(chunk);
+		ReleaseSemaphore((HANDLE)m_filledChunks, 1, nullptr);
+		if (chunk.endOfFile)
+			return;
+
+		chunkIndex = (chunkIndex + 1) % CHUNK_COUNT;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::decodeChunk( Chunk &chunk )
+{
+	chunk.commands.clear();
+	chunk.arguments.clear();
+	chunk.endOfFile = FALSE;
+
+	while ((Int)chunk.commands.size() < CHUNK_COMMANDS)
+	{
+		if (!decodeCommand(chunk))
+		{
+			chunk.endOfFile = TRUE;
+			break;
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Decodes one command in the format that RecorderClass::writeToFile writes. Returns false at the
+	* end of the file, a truncated command counts as the end of the file. */
+//-------------------------------------------------------------------------------------------------
+Bool ReplayCommandReader::decodeCommand( Chunk &chunk )
+{
+	ReplayCommand command;
+	if (!ensure(sizeof(command.frame)))
+		return FALSE;
+	readBytes(&command.frame, sizeof(command.frame));
+	command.position = m_readBufferPosition + m_readOffset;
+
+	GameMessage::Type type;
+	UnsignedByte numTypes = 0;
+	if (!ensure(sizeof(type) + sizeof(command.playerIndex) + sizeof(numTypes)))
+	{
+		DEBUG_LOG(("ReplayCommandReader::decodeCommand - truncated command on frame %u", command.frame));
+		return FALSE;
+	}
+	readBytes(&type, sizeof(type));
+	readBytes(&command.playerIndex, sizeof(command.playerIndex));
+	readBytes(&numTypes, sizeof(numTypes));
+	command.type = type;
+
+	UnsignedByte argTypes[256][2];
+	if (!ensure(numTypes * sizeof(argTypes[0])))
+	{
+		DEBUG_LOG(("ReplayCommandReader::decodeCommand - truncated command on frame %u", command.frame));
+		return FALSE;
+	}
+	readBytes(argTypes, numTypes * sizeof(argTypes[0]));
+
+	command.firstArgument = (Int)chunk.arguments.size();
+	for (Int i = 0; i < numTypes; ++i)
+	{
+		const GameMessageArgumentDataType argType = (GameMessageArgumentDataType)argTypes[i][0];
+		const Int numArgs = argTypes[i][1];
+		const Int argSize = getArgumentSize(argType);
+		if (argSize == 0)
+			continue;
+
+		if (!ensure(numArgs * argSize))
+		{
+			DEBUG_LOG(("ReplayCommandReader::decodeCommand - truncated command on frame %u", command.frame));
+			chunk.arguments.resize(command.firstArgument);
+			return FALSE;
+		}
+
+		for (Int j = 0; j < numArgs; ++j)
+		{
+			ReplayCommandArgument argument;
+			memset(&argument.value, 0, sizeof(argument.value));
+			argument.type = argType;
+			readBytes(&argument.value, argSize);
+			chunk.arguments.push_back(argument);
+		}
+	}
+	command.argumentCount = (Int)chunk.arguments.size() - command.firstArgument;
+
+	chunk.commands.push_back(command);
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Makes sure that the read buffer holds at least the given number of bytes. */
+//-------------------------------------------------------------------------------------------------
+Bool ReplayCommandReader::ensure( Int bytes )
+{
+	if (m_readEnd - m_readOffset >= bytes)
+		return TRUE;
+	if (m_endOfFile)
+		return FALSE;
+
+	// Move the unread bytes to the front
+	const Int remaining = m_readEnd - m_readOffset;
+	if (remaining > 0)
+		memmove(&m_readBuffer[0], &m_readBuffer[m_readOffset], remaining);
+	m_readBufferPosition += m_readOffset;
+	m_readOffset = 0;
+	m_readEnd = remaining;
+
+	const Int capacity = bytes > READ_BLOCK_BYTES ? bytes : (Int)READ_BLOCK_BYTES;
+	if ((Int)m_readBuffer.size() < capacity)
+		m_readBuffer.resize(capacity);
+
+	while (m_readEnd < bytes)
+	{
+		const Int bytesRead = m_file->read(&m_readBuffer[m_readEnd], (Int)m_readBuffer.size() - m_readEnd);
+		if (bytesRead <= 0)
+		{
+			m_endOfFile = TRUE;
+			return FALSE;
+		}
+		m_readEnd += bytesRead;
+	}
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+void ReplayCommandReader::readBytes( void *data, Int bytes )
+{
+	DEBUG_ASSERTCRASH(m_readEnd - m_readOffset >= bytes, ("ReplayCommandReader::readBytes - not enough bytes buffered"));
+	memcpy(data, &m_readBuffer[m_readOffset], bytes);
+	m_readOffset += bytes;
+}
@@ -20,8 +20,10 @@
 
 #include "Common/ReplaySimulation.h"
 
+#include "Common/DesyncTrace.h"
 #include "Common/GameEngine.h"
 #include "Common/LocalFileSystem.h"
+#include "Common/LogicProfiler.h"
 #include "Common/Recorder.h"
 #include "Common/WorkerProcess.h"
 #include "GameLogic/GameLogic.h"
@@ -34,6 +36,26 @@ UnsignedInt ReplaySimulation::s_replayCount = 0;
 
 namespace
 {
+// Printed by a replay worker process after each replay, followed by the result of that replay.
+const char* const ReplayWorkerResultMarker = "ReplayWorkerResult:";
+
+// Splits the output of a replay worker process at the result marker.
+// Returns false if the worker has not finished the replay yet.
+Bool parseReplayWorkerResult(const AsciiString& workerOutput, AsciiString& replayOutput, DWORD& exitcode)
+{
+	const char* marker = strstr(workerOutput.str(), ReplayWorkerResultMarker);
+	if (marker == nullptr)
+		return false;
+
+	const char* result = marker + strlen(ReplayWorkerResultMarker);
+	if (strchr(result, '\n') == nullptr)
+		return false; // The result line is not complete yet
+
+	replayOutput.set(workerOutput.str(), static_cast<Int>(marker - workerOutput.str()));
+	exitcode = static_cast<DWORD>(atoi(result));
+	return true;
+}
+
 int countProcessesRunning(const std::vector<WorkerProcess>& processes)
 {
 	int numProcessesRunning = 0;
@@ -45,12 +67,126 @@ int countProcessesRunning(const std::vector<WorkerProcess>& processes)
 	}
 	return numProcessesRunning;
 }
+
+void beginLogicProfile()
+{
+	if (TheGlobalData->m_logicProfileFile.isEmpty())
+		return;
+
+	LogicProfiler::reset();
+	LogicProfiler::setEnabled(true);
+}
+
+void endLogicProfile()
+{
+	if (!LogicProfiler::isEnabled())
+		return;
+
+	LogicProfiler::setEnabled(false);
+	if (LogicProfiler::writeReport(TheGlobalData->m_logicProfileFile))
+		printf("Logic profile written to \"%s\"\n", TheGlobalData->m_logicProfileFile.str());
+	else
+		printf("Cannot write logic profile to \"%s\"\n", TheGlobalData->m_logicProfileFile.str());
+	fflush(stdout);
+}
+
+void beginDesyncTrace()
+{
+	if (TheGlobalData->m_desyncTraceFile.isEmpty())
+		return;
+
+	if (!DesyncTrace::begin(TheGlobalData->m_desyncTraceFile, TheGlobalData->m_desyncDumpFrame))
+	{
+		printf("Cannot write desync trace to \"%s\"\n", TheGlobalData->m_desyncTraceFile.str());
+		fflush(stdout);
+	}
+}
+
+void endDesyncTrace()
+{
+	if (!DesyncTrace::isEnabled())
+		return;
+
+	DesyncTrace::end();
+	printf("Desync trace written to \"%s\"\n", TheGlobalData->m_desyncTraceFile.str());
+	fflush(stdout);
+}
+
+void seekReplay(UnsignedInt frame)
+{
+	if (TheRecorder->seekPlayback(frame))
+		printf("Continuing from the checkpoint at frame %u\n", TheGameLogic->getFrame());
+	else
+		printf("No usable checkpoint at or before frame %u, simulating from the start\n", frame);
+	fflush(stdout);
+}
 } // namespace
 
+int ReplaySimulation::simulateReplayInThisProcess(const AsciiString &filename)
+{
+	int numErrors = 0;
+	printf("Simulating Replay \"%s\"\n", filename.str());
+	fflush(stdout);
+	DWORD startTimeMillis = GetTickCount();
+	if (TheRecorder->simulateReplay(filename))
+	{
+		DesyncTrace::beginReplay(filename);
+
+		// Checkpoints are not written after a seek, because the playback reads from the same checkpoint file
+		Int checkpointInterval = TheGlobalData->m_replayCheckpointInterval;
+		if (TheGlobalData->m_replaySeekFrame > 0)
+		{
+			seekReplay(TheGlobalData->m_replaySeekFrame);
+			checkpointInterval = 0;
+		}
+
+		UnsignedInt totalTimeSec = TheRecorder->getPlaybackFrameCount() / LOGICFRAMES_PER_SECOND;
+		Bool stop = DesyncTrace::update();
+		while (!stop && TheRecorder->isPlaybackInProgress())
+		{
+			TheGameClient->updateHeadless();
+
+			const int progressFrameInterval = 10*60*LOGICFRAMES_PER_SECOND;
+			if (TheGameLogic->getFrame() != 0 && TheGameLogic->getFrame() % progressFrameInterval == 0)
+			{
+				// Print progress report
+				UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
+				UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
+				printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
+						realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
+				fflush(stdout);
+			}
+			TheGameLogic->UPDATE();
+			stop = DesyncTrace::update();
+			if (TheRecorder->sawCRCMismatch())
+			{
+				numErrors++;
+				break;
+			}
+			if (checkpointInterval > 0 && TheGameLogic->getFrame() % checkpointInterval == 0)
+				TheRecorder->writeCheckpoint();
+		}
+		UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
+		UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
+		printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
+				realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
+		fflush(stdout);
+	}
+	else
+	{
+		printf("Cannot open replay\n");
+		numErrors++;
+	}
+	return numErrors;
+}
+
 int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames)
 {
 	int numErrors = 0;
 
+	beginLogicProfile();
+	beginDesyncTrace();
+
 	if (!TheGlobalData->m_headless)
 	{
 		s_isRunning = true;
@@ -71,51 +207,15 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		s_isRunning = false;
 		s_replayIndex = 0;
 		s_replayCount = 0;
+		endLogicProfile();
+		endDesyncTrace();
 		return numErrors != 0 ? 1 : 0;
 	}
 	// Note that we use printf here because this is run from cmd.
 	DWORD totalStartTimeMillis = GetTickCount();
 	for (size_t i = 0; i < filenames.size(); i++)
 	{
-		AsciiString filename = filenames[i];
-		printf("Simulating Replay \"%s\"\n", filename.str());
-		fflush(stdout);
-		DWORD startTimeMillis = GetTickCount();
-		if (TheRecorder->simulateReplay(filename))
-		{
-			UnsignedInt totalTimeSec = TheRecorder->getPlaybackFrameCount() / LOGICFRAMES_PER_SECOND;
-			while (TheRecorder->isPlaybackInProgress())
-			{
-				TheGameClient->updateHeadless();
-
-				const int progressFrameInterval = 10*60*LOGICFRAMES_PER_SECOND;
-				if (TheGameLogic->getFrame() != 0 && TheGameLogic->getFrame() % progressFrameInterval == 0)
-				{
-					// Print progress report
-					UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
-					UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
-					printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
-							realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
-					fflush(stdout);
-				}
-				TheGameLogic->UPDATE();
-				if (TheRecorder->sawCRCMismatch())
-				{
-					numErrors++;
-					break;
-				}
-			}
-			UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
-			UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
-			printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
-					realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
-			fflush(stdout);
-		}
-		else
-		{
-			printf("Cannot open replay\n");
-			numErrors++;
-		}
+		numErrors += simulateReplayInThisProcess(filenames[i]);
 	}
 	if (filenames.size() > 1)
 	{
@@ -126,6 +226,8 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		fflush(stdout);
 	}
 
+	endLogicProfile();
+	endDesyncTrace();
 	return numErrors != 0 ? 1 : 0;
 }
 
@@ -203,6 +305,170 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	return numErrors != 0 ? 1 : 0;
 }
 
+int ReplaySimulation::simulateReplaysAsWorker(const std::vector<AsciiString> &filenames)
+{
+	// Simulate the replays from the command line first, then wait for more replays on stdin.
+	// The engine stays initialized in between, so each replay only pays for loading its map.
+	size_t i = 0;
+	while (true)
+	{
+		AsciiString filename;
+		if (i < filenames.size())
+		{
+			filename = filenames[i++];
+		}
+		else
+		{
+			char line[_MAX_PATH * 2];
+			if (fgets(line, ARRAY_SIZE(line), stdin) == nullptr)
+				break;
+			filename = line;
+			filename.trim();
+			if (filename.isEmpty())
+				break;
+		}
+
+		const int numErrors = simulateReplayInThisProcess(filename);
+		printf("%s %d\n", ReplayWorkerResultMarker, numErrors != 0 ? 1 : 0);
+		fflush(stdout);
+	}
+
+	return 0;
+}
+
+int ReplaySimulation::simulateReplaysInPersistentWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses)
+{
+	DWORD totalStartTimeMillis = GetTickCount();
+
+	WideChar exePath[1024];
+	GetModuleFileNameW(nullptr, exePath, ARRAY_SIZE(exePath));
+
+	const int numFilenames = static_cast<int>(filenames.size());
+	const int numProcesses = min(maxProcesses, numFilenames);
+
+	// Each worker keeps running and is given the next replay as soon as it reports the result of its current one.
+	std::vector<WorkerProcess> processes(numProcesses);
+	std::vector<int> processFilenamePosition(numProcesses, -1);
+
+	std::vector<AsciiString> replayOutputs(numFilenames);
+	std::vector<DWORD> replayExitcodes(numFilenames, 0);
+	std::vector<Bool> replayDone(numFilenames, false);
+
+	int filenamePositionStarted = 0;
+	int filenamePositionDone = 0;
+	int numErrors = 0;
+
+	while (true)
+	{
+		int i;
+		for (i = 0; i < numProcesses; i++)
+		{
+			WorkerProcess &process = processes[i];
+			process.update();
+
+			// Collect the result of the replay this worker is simulating
+			const int position = processFilenamePosition[i];
+			if (position >= 0)
+			{
+				AsciiString replayOutput;
+				DWORD exitcode = 0;
+				if (parseReplayWorkerResult(process.getStdOutput(), replayOutput, exitcode))
+				{
+					process.clearStdOutput();
+				}
+				else if (process.isDone())
+				{
+					// The worker exited in the middle of a replay, for example because it crashed
+					replayOutput = process.getStdOutput();
+					exitcode = process.getExitCode() != 0 ? process.getExitCode() : 1;
+				}
+				else
+				{
+					continue;
+				}
+
+				replayOutputs[position] = replayOutput;
+				replayExitcodes[position] = exitcode;
+				replayDone[position] = true;
+				processFilenamePosition[i] = -1;
+			}
+
+			if (filenamePositionStarted < numFilenames)
+			{
+				// Hand the next replay to this worker, or start a new worker if it is not running
+				const AsciiString &filename = filenames[filenamePositionStarted];
+				Bool started;
+				if (process.isRunning())
+				{
+					AsciiString line;
+					line.format("%s\n", filename.str());
+					started = process.writeStdInput(line);
+				}
+				else
+				{
+					UnicodeString filenameWide;
+					filenameWide.translate(filename);
+					UnicodeString command;
+					command.format(L"\"%s\"%s -headless -replayWorker -replay \"%s\"",
+						exePath,
+						TheGlobalData->m_windowed ? L" -win" : L"",
+						filenameWide.str());
+					started = process.startProcess(command, true);
+				}
+
+				if (started)
+				{
+					processFilenamePosition[i] = filenamePositionStarted;
+				}
+				else
+				{
+					process.kill();
+					replayOutputs[filenamePositionStarted].format("Cannot start worker process for replay \"%s\"\n", filename.str());
+					replayExitcodes[filenamePositionStarted] = 1;
+					replayDone[filenamePositionStarted] = true;
+				}
+				filenamePositionStarted++;
+			}
+			else
+			{
+				// No replays left, let the worker exit
+				process.closeStdInput();
+			}
+		}
+
+		// Print output of finished replays in order
+		while (filenamePositionDone < numFilenames && replayDone[filenamePositionDone])
+		{
+			printf("%d/%d %s", filenamePositionDone+1, numFilenames, replayOutputs[filenamePositionDone].str());
+			DWORD exitcode = replayExitcodes[filenamePositionDone];
+			if (exitcode != 0)
+				printf("Error!\n");
+			fflush(stdout);
+			numErrors += exitcode == 0 ? 0 : 1;
+			replayOutputs[filenamePositionDone].clear();
+			filenamePositionDone++;
+		}
+
+		if (filenamePositionDone == numFilenames && countProcessesRunning(processes) == 0)
+			break;
+
+		// Don't waste CPU here, our workers need every bit of CPU time they can get.
+		// The sleep is shorter than for the single replay workers because the workers wait for us between replays.
+		Sleep(10);
+	}
+
+	DEBUG_ASSERTCRASH(filenamePositionStarted == numFilenames, ("inconsistent file position 1"));
+	DEBUG_ASSERTCRASH(filenamePositionDone == numFilenames, ("inconsistent file position 2"));
+
+	printf("Simulation of all replays completed. Errors occurred: %d\n", numErrors);
+
+	UnsignedInt realTime = (GetTickCount()-totalStartTimeMillis) / 1000;
+	printf("Total Wall Time: %d:%02d:%02d\n", realTime/60/60, realTime/60%60, realTime%60);
+	fflush(stdout);
+
+	return numErrors != 0 ? 1 : 0;
+}
+
 std::vector<AsciiString> ReplaySimulation::resolveFilenameWildcards(const std::vector<AsciiString> &filenames)
 {
 	// If some filename contains wildcards, search for actual filenames.
@@ -248,8 +514,16 @@ std::vector<AsciiString> ReplaySimulation::resolveFilenameWildcards(const std::v
 int ReplaySimulation::simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses)
 {
 	std::vector<AsciiString> filenamesResolved = resolveFilenameWildcards(filenames);
-	if (maxProcesses == SIMULATE_REPLAYS_SEQUENTIAL)
+	if (TheGlobalData->m_logicProfileFile.isNotEmpty() && maxProcesses != SIMULATE_REPLAYS_SEQUENTIAL)
+		printf("-logicProfile is ignored when simulating replays with -jobs\n");
+	if (TheGlobalData->m_desyncTraceFile.isNotEmpty() && maxProcesses != SIMULATE_REPLAYS_SEQUENTIAL)
+		printf("-desyncTrace is ignored when simulating replays with -jobs\n");
+	if (TheGlobalData->m_simulateReplayWorker && TheGlobalData->m_headless)
+		return simulateReplaysAsWorker(filenamesResolved);
+	else if (maxProcesses == SIMULATE_REPLAYS_SEQUENTIAL)
 		return simulateReplaysInThisProcess(filenamesResolved);
+	else if (TheGlobalData->m_simulateReplayPersistentJobs && TheGlobalData->m_headless)
+		return simulateReplaysInPersistentWorkerProcesses(filenamesResolved, maxProcesses);
 	else
 		return simulateReplaysInWorkerProcesses(filenamesResolved, maxProcesses);
 }
@@ -0,0 +1,378 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/SaveGameFile.h"
+
+#include "Common/Xfer.h"
+#include "Compression.h"
+
+#include "thread.h"
+
+
+namespace
+{
+const char s_compressedSaveTag[4] = { 'C', 'S', 'A', 'V' };
+
+Bool appendBytes(FILE *fp, std::vector<UnsignedByte> &data, Int size)
+{
+	if (size <= 0)
+		return TRUE;
+
+	const size_t offset = data.size();
+	data.resize(offset + size);
+	return fread(&data[offset], size, 1, fp) == 1;
+}
+
+// Reads plain save data, which is the token and the data of each block, and the end of file token.
+Bool readPlainBlocks(FILE *fp, std::vector<UnsignedByte> &data, Int maxBlocks)
+{
+	if (maxBlocks < 0)
+	{
+		fseek(fp, 0, SEEK_END);
+		const Int fileSize = (Int)ftell(fp);
+		fseek(fp, 0, SEEK_SET);
+		return appendBytes(fp, data, fileSize);
+	}
+
+	for (Int i = 0; i < maxBlocks; ++i)
+	{
+		const Int tokenOffset = (Int)data.size();
+		if (!appendBytes(fp, data, sizeof(UnsignedByte)) || !appendBytes(fp, data, data[tokenOffset]))
+			return FALSE;
+
+		// The end of file token has no block
+		const Int blockSizeOffset = (Int)data.size();
+		if (!appendBytes(fp, data, sizeof(XferBlockSize)))
+		{
+			data.resize(blockSizeOffset);
+			return TRUE;
+		}
+
+		XferBlockSize blockSize;
+		memcpy(&blockSize, &data[blockSizeOffset], sizeof(blockSize));
+		if (blockSize < 0 || !appendBytes(fp, data, blockSize))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+Bool readCompressedBlocks(FILE *fp, std::vector<UnsignedByte> &data, Int maxBlocks)
+{
+	UnsignedInt blockCount;
+	if (fread(&blockCount, sizeof(blockCount), 1, fp) != 1)
+		return FALSE;
+	if (maxBlocks >= 0 && (UnsignedInt)maxBlocks < blockCount)
+		blockCount = maxBlocks;
+
+	std::vector<UnsignedByte> compressed;
+	for (UnsignedInt i = 0; i < blockCount; ++i)
+	{
+		Int compressedSize;
+		if (fread(&compressedSize, sizeof(compressedSize), 1, fp) != 1 || compressedSize <= 0)
+			return FALSE;
+
+		compressed.resize(compressedSize);
+		if (fread(&compressed[0], compressedSize, 1, fp) != 1)
+			return FALSE;
+
+		const Int blockSize = CompressionManager::getUncompressedSize(&compressed[0], compressedSize);
+		if (blockSize <= 0)
+			return FALSE;
+
+		const size_t offset = data.size();
+		data.resize(offset + blockSize);
+		if (CompressionManager::decompressData(&compressed[0], compressedSize, &data[offset], blockSize) != blockSize)
+			return FALSE;
+	}
+	return TRUE;
+}
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+class SaveGameWriteThread : public ThreadClass
+{
+public:
+
+	SaveGameWriteThread(SaveGameFile *file)
+		: ThreadClass("SaveGameWriteThread")
+		, m_file(file)
+	{
+	}
+
+	virtual void Thread_Function() override
+	{
+		m_file->writeFile();
+	}
+
+private:
+
+	SaveGameFile *m_file;
+};
+
+//-------------------------------------------------------------------------------------------------
+SaveGameFile::SaveGameFile()
+	: m_fp(nullptr)
+	, m_compress(FALSE)
+	, m_incremental(FALSE)
+	, m_writeSucceeded(TRUE)
+	, m_thread(nullptr)
+	, m_writeDone(nullptr)
+{
+	m_filepath[0] = 0;
+	m_tempFilepath[0] = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+SaveGameFile::~SaveGameFile()
+{
+	waitForWrite();
+
+	if (m_writeDone != nullptr)
+		CloseHandle((HANDLE)m_writeDone);
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool SaveGameFile::write( const AsciiString &filepath, std::vector<UnsignedByte> &data, Bool compress, Bool incremental )
+{
+	waitForWrite();
+
+	// The thread gets its own copies, because AsciiString is not thread safe
+	strlcpy(m_filepath, filepath.str(), ARRAY_SIZE(m_filepath));
+	snprintf(m_tempFilepath, ARRAY_SIZE(m_tempFilepath), "%s.tmp", filepath.str());
+
+	// The file is opened here, so that the caller can tell the user right away when it cannot be
+	m_fp = fopen(m_tempFilepath, "wb");
+	if (m_fp == nullptr)
+		return FALSE;
+
+	m_data.swap(data);
+	data.clear();
+	m_compress = compress;
+	m_incremental = compress && incremental;
+	m_writeSucceeded = FALSE;
+
+	if (m_writeDone == nullptr)
+		m_writeDone = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+	else
+		ResetEvent((HANDLE)m_writeDone);
+
+	m_thread = NEW SaveGameWriteThread(this);
+	m_thread->Execute();
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool SaveGameFile::isWriting() const
+{
+	return m_thread != nullptr && WaitForSingleObject((HANDLE)m_writeDone, 0) == WAIT_TIMEOUT;
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool SaveGameFile::waitForWrite()
+{
+	if (m_thread != nullptr)
+	{
+		WaitForSingleObject((HANDLE)m_writeDone, INFINITE);
+
+		// The thread function has returned, so this does not need to stop it.
+		delete m_thread;
+		m_thread = nullptr;
+	}
+	return m_writeSucceeded;
+}
+
+//-------------------------------------------------------------------------------------------------
+void SaveGameFile::clearPreviousBlocks()
+{
+	waitForWrite();
+
+	std::vector<UnsignedByte>().swap(m_previousData);
+	m_previousBlockOffsets.clear();
+	m_previousCompressedBlocks.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+Bool SaveGameFile::readFile( const AsciiString &filepath, std::vector<UnsignedByte> &data, Int maxBlocks )
+{
+	data.clear();
+
+	FILE *fp = fopen(filepath.str(), "rb");
+	if (fp == nullptr)
+		return FALSE;
+
+	Bool succeeded;
+	char tag[sizeof(s_compressedSaveTag)];
+	if (fread(tag, sizeof(tag), 1, fp) == 1 && memcmp(tag, s_compressedSaveTag, sizeof(tag)) == 0)
+	{
+		succeeded = readCompressedBlocks(fp, data, maxBlocks);
+	}
+	else
+	{
+		fseek(fp, 0, SEEK_SET);
+		succeeded = readPlainBlocks(fp, data, maxBlocks);
+	}
+
+	fclose(fp);
+
+	if (!succeeded)
+		DEBUG_LOG(("SaveGameFile::readFile - Error reading '%s'", filepath.str()));
+	return succeeded;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Runs on the thread. Compresses the data if requested and writes it to the file. */
+//-------------------------------------------------------------------------------------------------
+void SaveGameFile::writeFile()
+{
+	Bool succeeded = TRUE;
+	Bool compressed = FALSE;
+
+	if (m_compress)
+	{
+		splitBlocks();
+		compressed = compressBlocks();
+	}
+
+	if (compressed)
+	{
+		const UnsignedInt blockCount = (UnsignedInt)m_compressedBlocks.size();
+		succeeded = fwrite(s_compressedSaveTag, sizeof(s_compressedSaveTag), 1, m_fp) == 1
+			&& fwrite(&blockCount, sizeof(blockCount), 1, m_fp) == 1;
+
+		for (UnsignedInt i = 0; succeeded && i < blockCount; ++i)
+		{
+			const std::vector<UnsignedByte> &block = m_compressedBlocks[i];
+			const Int blockSize = (Int)block.size();
+			succeeded = fwrite(&blockSize, sizeof(blockSize), 1, m_fp) == 1
+				&& fwrite(&block[0], blockSize, 1, m_fp) == 1;
+		}
+	}
+	else if (!m_data.empty())
+	{
+		succeeded = fwrite(&m_data[0], m_data.size(), 1, m_fp) == 1;
+	}
+
+	if (fclose(m_fp) != 0)
+		succeeded = FALSE;
+	m_fp = nullptr;
+
+	// Only a complete file replaces the previous save
+	if (succeeded)
+		succeeded = MoveFileEx(m_tempFilepath, m_filepath, MOVEFILE_REPLACE_EXISTING) != 0;
+	if (!succeeded)
+		DeleteFile(m_tempFilepath);
+
+	// Keep the blocks for the next incremental write
+	if (m_incremental && compressed)
+	{
+		m_previousData.swap(m_data);
+		m_previousBlockOffsets.swap(m_blockOffsets);
+		m_previousCompressedBlocks.swap(m_compressedBlocks);
+	}
+	else
+	{
+		std::vector<UnsignedByte>().swap(m_previousData);
+		m_previousBlockOffsets.clear();
+		m_previousCompressedBlocks.clear();
+	}
+	std::vector<UnsignedByte>().swap(m_data);
+	m_blockOffsets.clear();
+	m_compressedBlocks.clear();
+
+	if (!succeeded)
+		DEBUG_LOG(("SaveGameFile::writeFile - Error writing '%s'", m_filepath));
+
+	m_writeSucceeded = succeeded;
+	SetEvent((HANDLE)m_writeDone);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Finds the top level blocks in the save data. Each block is its token followed by the block size
+	* and the block data. The end of file token is the last block. */
+//-------------------------------------------------------------------------------------------------
+void SaveGameFile::splitBlocks()
+{
+	m_blockOffsets.clear();
+
+	const Int dataSize = (Int)m_data.size();
+	Int offset = 0;
+	while (offset < dataSize)
+	{
+		m_blockOffsets.push_back(offset);
+
+		// skip the token
+		offset += sizeof(UnsignedByte) + m_data[offset];
+		if (offset + (Int)sizeof(XferBlockSize) > dataSize)
+			break;
+
+		XferBlockSize blockSize;
+		memcpy(&blockSize, &m_data[offset], sizeof(blockSize));
+		if (blockSize < 0)
+			break;
+		offset += sizeof(blockSize) + blockSize;
+	}
+
+	m_blockOffsets.push_back(dataSize);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Compresses every block, or reuses the compressed data of an identical block of the previous
+	* incremental write. Returns false if a block could not be compressed. */
+//-------------------------------------------------------------------------------------------------
+Bool SaveGameFile::compressBlocks()
+{
+	const CompressionType compressionType = CompressionManager::getPreferredCompression();
+	const Int blockCount = (Int)m_blockOffsets.size() - 1;
+	const Int previousBlockCount = (Int)m_previousCompressedBlocks.size();
+	Int reusedBlocks = 0;
+
+	m_compressedBlocks.resize(blockCount);
+	for (Int i = 0; i < blockCount; ++i)
+	{
+		const Int begin = m_blockOffsets[i];
+		const Int size = m_blockOffsets[i + 1] - begin;
+		std::vector<UnsignedByte> &compressed = m_compressedBlocks[i];
+
+		if (m_incremental && i < previousBlockCount)
+		{
+			const Int previousBegin = m_previousBlockOffsets[i];
+			const Int previousSize = m_previousBlockOffsets[i + 1] - previousBegin;
+			if (previousSize == size && memcmp(&m_data[begin], &m_previousData[previousBegin], size) == 0)
+			{
+				compressed.swap(m_previousCompressedBlocks[i]);
+				++reusedBlocks;
+				continue;
+			}
+		}
+
+		compressed.resize(CompressionManager::getMaxCompressedSize(size, compressionType));
+		const Int compressedSize = CompressionManager::compressData(compressionType, &m_data[begin], size,
+			&compressed[0], (Int)compressed.size());
+		if (compressedSize <= 0)
+		{
+			DEBUG_LOG(("SaveGameFile::compressBlocks - Error compressing block %d", i));
+			return FALSE;
+		}
+		compressed.resize(compressedSize);
+	}
+
+	DEBUG_LOG(("SaveGameFile::compressBlocks - Compressed %d blocks, reused %d blocks", blockCount - reusedBlocks, reusedBlocks));
+	return TRUE;
+}
@@ -50,6 +50,7 @@
 #include "Common/ArchiveFileSystem.h"
 #include "Common/AsciiString.h"
 #include "Common/PerfTimer.h"
+#include "Utility/endian_compat.h"
 
 
 //----------------------------------------------------------------------------
@@ -168,6 +169,18 @@ void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool ove
 
 		dirInfo->m_files.insert(fileIt, std::make_pair(token, archiveFile));
 
+		Char key[_MAX_PATH];
+		if (buildArchivedFileKey(it->str(), key, ARRAY_SIZE(key)))
+		{
+			ArchivedFileLookupInfo &lookupInfo = m_archivedFiles[rts::string_key<AsciiString>(key)];
+			lookupInfo.dirInfo = dirInfo;
+			lookupInfo.first = dirInfo->m_files.lower_bound(token);
+		}
+		else
+		{
+			DEBUG_CRASH(("ArchiveFileSystem::loadIntoDirectoryTree - path of file %s is too long", it->str()));
+		}
+
 #if defined(DEBUG_LOGGING) && ENABLE_FILESYSTEM_LOGGING
 		{
 			const stl::const_range<ArchivedFileLocationMap> range = stl::get_range(dirInfo->m_files, token, 0);
@@ -210,6 +223,115 @@ void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool ove
 	}
 }
 
+//------------------------------------------------------
+// TheSuperHackers @performance Reads the directory listing of a BIG file with as few reads as possible
+// and parses it in memory. The listing starts at offset 0x10 and ends at the offset of the first file.
+// Each entry is the big endian offset and size of the file, followed by its null terminated path.
+//------------------------------------------------------
+Bool ArchiveFileSystem::loadBIGFileDirectory(File *fp, const AsciiString& archiveFileName, Int numFiles, Int directoryEnd, ArchiveFile *archiveFile)
+{
+	const Int directoryStart = 0x10;
+	const Int entryHeaderSize = 8;
+
+	// The listing cannot be larger than the archive, and every entry takes at least its header and a terminator.
+	const Int maxDirectorySize = fp->size() - directoryStart;
+	if (numFiles < 0 || maxDirectorySize < 0 || numFiles > maxDirectorySize / (entryHeaderSize + 1)) {
+		return FALSE;
+	}
+
+	// Some tools do not write a sensible directory end. Then guess the size and grow the buffer as needed.
+	Int directorySize = directoryEnd - directoryStart;
+	if (directorySize < numFiles * (entryHeaderSize + 1)) {
+		if (numFiles > maxDirectorySize / (entryHeaderSize + 32)) {
+			directorySize = maxDirectorySize;
+		} else {
+			directorySize = numFiles * (entryHeaderSize + 32);
+		}
+	}
+	if (directorySize > maxDirectorySize) {
+		directorySize = maxDirectorySize;
+	}
+
+	std::vector<char> directory;
+	Int bytesRead = 0;
+	Int numFilesInBuffer = 0;
+
+	while (true)
+	{
+		directory.resize(directorySize + 1);
+		if (fp->seek(directoryStart, File::START) != directoryStart) {
+			return FALSE;
+		}
+		bytesRead = fp->read(&directory[0], directorySize);
+		if (bytesRead < 0) {
+			return FALSE;
+		}
+
+		// Check that all entries are contained in what we read
+		Int pos = 0;
+		for (numFilesInBuffer = 0; numFilesInBuffer < numFiles; ++numFilesInBuffer) {
+			if (pos + entryHeaderSize >= bytesRead) {
+				break;
+			}
+			const char *path = &directory[pos + entryHeaderSize];
+			const char *pathEnd = static_cast<const char *>(memchr(path, 0, bytesRead - pos - entryHeaderSize));
+			if (pathEnd == nullptr) {
+				break;
+			}
+			pos = static_cast<Int>(pathEnd - &directory[0]) + 1;
+		}
+
+		if (numFilesInBuffer == numFiles) {
+			break;
+		}
+
+		if (bytesRead < directorySize || directorySize == maxDirectorySize) {
+			// Reached the end of the archive before the end of the directory listing
+			return FALSE;
+		}
+
+		if (directorySize > maxDirectorySize / 2) {
+			directorySize = maxDirectorySize;
+		} else {
+			directorySize *= 2;
+		}
+	}
+
+	ArchivedFileInfo fileInfo;
+	fileInfo.m_archiveFilename = archiveFileName;
+
+	AsciiString path;
+	const char *entry = &directory[0];
+
+	for (Int i = 0; i < numFiles; ++i) {
+		UnsignedInt fileOffset;
+		UnsignedInt filesize;
+		memcpy(&fileOffset, entry, 4);
+		memcpy(&filesize, entry + 4, 4);
+
+		fileInfo.m_offset = betoh(fileOffset);
+		fileInfo.m_size = betoh(filesize);
+
+		const char *fullPath = entry + entryHeaderSize;
+		const Int pathLength = static_cast<Int>(strlen(fullPath));
+
+		Int filenameIndex = pathLength - 1;
+		while ((filenameIndex >= 0) && (fullPath[filenameIndex] != '\\') && (fullPath[filenameIndex] != '/')) {
+			--filenameIndex;
+		}
+
+		fileInfo.m_filename = fullPath + filenameIndex + 1;
+		fileInfo.m_filename.toLower();
+		path.set(fullPath, filenameIndex + 1);
+
+		archiveFile->addFile(path, &fileInfo);
+
+		entry = fullPath + pathLength + 1;
+	}
+
+	return TRUE;
+}
+
 void ArchiveFileSystem::loadMods()
 {
 	if (TheGlobalData->m_modBIG.isNotEmpty())
@@ -238,14 +360,79 @@ void ArchiveFileSystem::loadMods()
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
+	return findArchiveFile(filename, instance) != nullptr;
+}
+
+//------------------------------------------------------
+// Builds the key of m_archivedFiles from a file path. This resolves the path exactly like the
+// directory tree walk in loadIntoDirectoryTree and getArchivedDirectoryInfo: the path is lower case,
+// separated by '\\', and ends with the first token that contains a '.' and is not followed by another '.'.
+//------------------------------------------------------
+Bool ArchiveFileSystem::buildArchivedFileKey(const Char *filename, Char *key, Int keySize)
+{
+	const Char *rest = filename;
+	const Char *token = "";
+	Int tokenLength = 0;
+	Int keyLength = 0;
+
+	while (true)
+	{
+		// Get the next token like AsciiString::nextToken. The token is kept when there is nothing left.
+		Bool infoInPath = FALSE;
+		if (*rest != 0)
+		{
+			const Char *start = rest;
+			while (*start == '\\' || *start == '/')
+				++start;
+			const Char *end = start;
+			while (*end != 0 && *end != '\\' && *end != '/')
+				++end;
+
+			infoInPath = end > start;
+			token = infoInPath ? start : "";
+			tokenLength = static_cast<Int>(end - start);
+			rest = end;
+		}
+
+		const Bool isDirectory = infoInPath && (memchr(token, '.', tokenLength) == nullptr || strchr(rest, '.') != nullptr);
 
-	if (!result.valid())
-		return false;
+		if (keyLength + tokenLength + 1 >= keySize)
+			return FALSE;
 
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
+		for (Int i = 0; i < tokenLength; ++i)
+			key[keyLength++] = static_cast<Char>(tolower(token[i]));
 
-	return range.valid();
+		if (!isDirectory)
+			break;
+
+		key[keyLength++] = '\\';
+	}
+
+	key[keyLength] = 0;
+	return TRUE;
+}
+
+ArchiveFile* ArchiveFileSystem::findArchiveFile(const Char *filename, FileInstance instance) const
+{
+	Char key[_MAX_PATH];
+	if (!buildArchivedFileKey(filename, key, ARRAY_SIZE(key)))
+		return nullptr;
+
+	ArchivedFileLookupMap::const_iterator lookupIt = m_archivedFiles.find(rts::string_key<AsciiString>::temporary(key));
+	if (lookupIt == m_archivedFiles.end())
+		return nullptr;
+
+	// Step to the requested instance of the file
+	const ArchivedFileLookupInfo &lookupInfo = lookupIt->second;
+	ArchivedFileLocationMap::const_iterator fileIt = lookupInfo.first;
+	for (FileInstance i = 0; i < instance; ++i)
+	{
+		++fileIt;
+		if (fileIt == lookupInfo.dirInfo->m_files.end() || fileIt->first != lookupInfo.first->first)
+			return nullptr;
+	}
+
+	return fileIt->second;
 }
 
 ArchivedDirectoryInfo* ArchiveFileSystem::friend_getArchivedDirectoryInfo(const Char* directory)
@@ -317,17 +504,7 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 
 ArchiveFile* ArchiveFileSystem::getArchiveFile(const AsciiString& filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename.str());
-
-	if (!result.valid())
-		return nullptr;
-
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
-
-	if (!range.valid())
-		return nullptr;
-	
-	return range.get()->second;
+	return findArchiveFile(filename.str(), instance);
 }
 
 void ArchiveFileSystem::getFileListInDirectory(const AsciiString& currentDirectory, const AsciiString& originalDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const
@@ -195,6 +195,12 @@ DECLARE_PERF_TIMER(MemoryPoolInitFilling)
 static Bool thePreMainInitFlag = false;
 static Bool theMainInitFlag = false;
 
+#ifdef MEMORYPOOL_MAGAZINES
+	/// thread local value: the magazine slot of the thread plus one, or zero if the thread has no magazines
+	static DWORD theMagazineTlsIndex = TLS_OUT_OF_INDEXES;
+	static Bool theMagazineSlotInUse[MAX_MEMORYPOOL_MAGAZINE_THREADS];
+#endif
+
 // ----------------------------------------------------------------------------
 // PRIVATE PROTOTYPES
 // ----------------------------------------------------------------------------
@@ -223,6 +229,42 @@ static Int roundUpMemBound(Int i)
 	return (i + (MEM_BOUND_ALIGNMENT-1)) & ~(MEM_BOUND_ALIGNMENT-1);
 }
 
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+/** return the magazine slot of the calling thread, or -1 if it has no magazines */
+inline Int getMagazineSlot()
+{
+	if (theMagazineTlsIndex == TLS_OUT_OF_INDEXES)
+		return -1;
+
+	// TlsGetValue clears the last error, which callers of the allocator may still want to read.
+	const DWORD lastError = GetLastError();
+	const Int slot = (Int)(size_t)TlsGetValue(theMagazineTlsIndex) - 1;
+	SetLastError(lastError);
+	return slot;
+}
+
+// The casts keep these compatible with the older Platform SDK declarations of the Interlocked functions.
+inline long interlockedIncrement(volatile long *value)
+{
+	return InterlockedIncrement((LONG *)value);
+}
+
+inline long interlockedDecrement(volatile long *value)
+{
+	return InterlockedDecrement((LONG *)value);
+}
+
+inline long interlockedCompareExchange(volatile long *destination, long exchange, long comparand)
+{
+#if defined(_MSC_VER) && _MSC_VER < 1300
+	return (long)InterlockedCompareExchange((PVOID *)destination, (PVOID)exchange, (PVOID)comparand);
+#else
+	return InterlockedCompareExchange((LONG *)destination, exchange, comparand);
+#endif
+}
+#endif
+
 //-----------------------------------------------------------------------------
 /**
 	this is the low-level allocator that we use to request memory from the OS.
@@ -504,6 +546,21 @@ public:
 
 };
 
+#ifdef MEMORYPOOL_MAGAZINES
+// ----------------------------------------------------------------------------
+/**
+	Free blocks of one pool that one thread keeps for itself. Only that thread touches the
+	magazine without holding the pool lock. The blocks count as used in their blobs, but
+	as free in the pool.
+*/
+class MemoryPoolMagazine
+{
+public:
+	Int											m_count;														///< number of blocks in the magazine
+	MemoryPoolSingleBlock		*m_blocks[MEMORYPOOL_MAGAZINE_SIZE];	///< the blocks, the most recently freed last
+};
+#endif
+
 // ----------------------------------------------------------------------------
 // PUBLIC DATA
 // ----------------------------------------------------------------------------
@@ -1509,6 +1566,10 @@ MemoryPool::MemoryPool() :
 	m_lastBlob(nullptr),
 	m_firstBlobWithFreeBlocks(nullptr)
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	for (Int i = 0; i < MAX_MEMORYPOOL_MAGAZINE_THREADS; ++i)
+		m_magazines[i] = nullptr;
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -1540,6 +1601,18 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 */
 MemoryPool::~MemoryPool()
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	for (Int i = 0; i < MAX_MEMORYPOOL_MAGAZINE_THREADS; ++i)
+	{
+		if (m_magazines[i])
+		{
+			flushMagazine(i);
+			::sysFree((void *)m_magazines[i]);
+			m_magazines[i] = nullptr;
+		}
+	}
+#endif
+
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
 	while (m_firstBlob)
@@ -1620,6 +1693,43 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 	return amtFreed;
 }
 
+//-----------------------------------------------------------------------------
+/**
+	count a block that was handed out, and update the high-water mark. threads with
+	magazines do this without the pool lock, so then the counts change atomically.
+*/
+void MemoryPool::noteBlockAllocated()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	const long used = interlockedIncrement((volatile long *)&m_usedBlocksInPool);
+	long peak = m_peakUsedBlocksInPool;
+	while (peak < used)
+	{
+		const long previousPeak = interlockedCompareExchange((volatile long *)&m_peakUsedBlocksInPool, used, peak);
+		if (previousPeak == peak)
+			break;
+		peak = previousPeak;
+	}
+#else
+	++m_usedBlocksInPool;
+	if (m_peakUsedBlocksInPool < m_usedBlocksInPool)
+		m_peakUsedBlocksInPool = m_usedBlocksInPool;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+/**
+	count a block that was given back.
+*/
+void MemoryPool::noteBlockFreed()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	interlockedDecrement((volatile long *)&m_usedBlocksInPool);
+#else
+	--m_usedBlocksInPool;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 /**
 	allocate a block from this pool and return it, but don't bother zeroing
@@ -1628,6 +1738,21 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 */
 void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	// TheSuperHackers @performance Threads with magazines take the most recently freed block of their
+	// magazine without taking the lock.
+	const Int slot = getMagazineSlot();
+	if (slot >= 0)
+	{
+		MemoryPoolMagazine *magazine = m_magazines[slot];
+		if (magazine && magazine->m_count > 0)
+		{
+			noteBlockAllocated();
+			return magazine->m_blocks[--magazine->m_count]->getUserData();
+		}
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
 	if (m_firstBlobWithFreeBlocks != nullptr && !m_firstBlobWithFreeBlocks->hasAnyFreeBlocks())
@@ -1674,9 +1799,7 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 #endif
 
 	// bookkeeping
-	++m_usedBlocksInPool;
-	if (m_peakUsedBlocksInPool < m_usedBlocksInPool)
-		m_peakUsedBlocksInPool = m_usedBlocksInPool;
+	noteBlockAllocated();
 
 #ifdef MEMORYPOOL_DEBUG
 	m_factory->adjustTotals(debugLiteralTagString, 1*getAllocationSize(), 0);
@@ -1688,6 +1811,12 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 	#endif
 #endif
 
+#ifdef MEMORYPOOL_MAGAZINES
+	// the magazine is missing or empty, so take the next few blocks while we hold the lock anyway.
+	if (slot >= 0)
+		refillMagazine(slot);
+#endif
+
 	return block->getUserData();
 }
 
@@ -1713,6 +1842,24 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;	// my, that was easy
 
+#ifdef MEMORYPOOL_MAGAZINES
+	// TheSuperHackers @performance Threads with magazines keep the block in their magazine without
+	// taking the lock.
+	const Int slot = getMagazineSlot();
+	if (slot >= 0)
+	{
+		MemoryPoolMagazine *magazine = m_magazines[slot];
+		if (magazine && magazine->m_count < MEMORYPOOL_MAGAZINE_SIZE)
+		{
+			MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+			DEBUG_ASSERTCRASH(block->getOwningBlob() && block->getOwningBlob()->getOwningPool() == this, ("block does not belong to this pool"));
+			magazine->m_blocks[magazine->m_count++] = block;
+			noteBlockFreed();
+			return;
+		}
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
 	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
@@ -1745,13 +1892,112 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 		m_firstBlobWithFreeBlocks = blob;
 
 	// bookkeeping
-	--m_usedBlocksInPool;
+	noteBlockFreed();
 
 #ifdef MEMORYPOOL_DEBUG
 	m_factory->adjustTotals(tagString, -1*getAllocationSize(), 0);
 #endif
+
+#ifdef MEMORYPOOL_MAGAZINES
+	// the magazine is missing or full, so make room for the next few blocks while we hold the lock anyway.
+	if (slot >= 0)
+		drainMagazine(slot, MEMORYPOOL_MAGAZINE_SIZE / 2);
+#endif
+}
+
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+MemoryPoolMagazine *MemoryPool::getMagazine(Int slot)
+{
+	MemoryPoolMagazine *magazine = m_magazines[slot];
+	if (!magazine)
+	{
+		magazine = (MemoryPoolMagazine *)::sysAllocateDoNotZero(sizeof(MemoryPoolMagazine));	// will throw on failure
+		magazine->m_count = 0;
+		m_magazines[slot] = magazine;
+	}
+	return magazine;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	fill the magazine up to half its size with free blocks of the existing blobs. this never
+	creates a blob, so caching blocks does not make the pool grow.
+*/
+void MemoryPool::refillMagazine(Int slot)
+{
+	MemoryPoolMagazine *magazine = getMagazine(slot);
+
+	while (magazine->m_count < MEMORYPOOL_MAGAZINE_SIZE / 2)
+	{
+		if (m_firstBlobWithFreeBlocks == nullptr || !m_firstBlobWithFreeBlocks->hasAnyFreeBlocks())
+		{
+			MemoryPoolBlob *blob = m_firstBlob;
+			for (; blob != nullptr; blob = blob->getNextInList())
+			{
+				if (blob->hasAnyFreeBlocks())
+					break;
+			}
+			m_firstBlobWithFreeBlocks = blob;
+			if (blob == nullptr)
+				break;
+		}
+
+		magazine->m_blocks[magazine->m_count++] = m_firstBlobWithFreeBlocks->allocateSingleBlock();
+	}
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give the oldest blocks of the magazine back to their blobs until keepCount are left.
+*/
+void MemoryPool::drainMagazine(Int slot, Int keepCount)
+{
+	MemoryPoolMagazine *magazine = getMagazine(slot);
+	if (magazine->m_count <= keepCount)
+		return;
+
+	const Int drainCount = magazine->m_count - keepCount;
+	for (Int i = 0; i < drainCount; ++i)
+	{
+		MemoryPoolBlob *blob = magazine->m_blocks[i]->getOwningBlob();
+		blob->freeSingleBlock(magazine->m_blocks[i]);
+		if (!m_firstBlobWithFreeBlocks)
+			m_firstBlobWithFreeBlocks = blob;
+	}
+	memmove(&magazine->m_blocks[0], &magazine->m_blocks[drainCount], keepCount * sizeof(magazine->m_blocks[0]));
+	magazine->m_count = keepCount;
 }
 
+//-----------------------------------------------------------------------------
+/**
+	give all blocks of the magazine of the given thread slot back to their blobs.
+*/
+void MemoryPool::flushMagazine(Int slot)
+{
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	if (m_magazines[slot])
+		drainMagazine(slot, 0);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	the cached blocks of other threads can change while this runs, so the result is only
+	exact while no other thread uses the pool.
+*/
+Int MemoryPool::getCachedBlockCount()
+{
+	Int count = 0;
+	for (Int i = 0; i < MAX_MEMORYPOOL_MAGAZINE_THREADS; ++i)
+	{
+		if (m_magazines[i])
+			count += m_magazines[i]->m_count;
+	}
+	return count;
+}
+#endif
+
 //-----------------------------------------------------------------------------
 Int MemoryPool::countBlobsInPool()
 {
@@ -1795,6 +2041,12 @@ void MemoryPool::reset()
 {
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+#ifdef MEMORYPOOL_MAGAZINES
+	// the cached blocks go away with their blobs.
+	for (Int i = 0; i < MAX_MEMORYPOOL_MAGAZINE_THREADS; ++i)
+		flushMagazine(i);
+#endif
+
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
 	while (m_firstBlob)
@@ -2963,6 +3215,31 @@ void MemoryPoolFactory::debugResetCheckpoints()
 }
 #endif
 
+//-----------------------------------------------------------------------------
+Int MemoryPoolFactory::getPeakPoolBytes()
+{
+	Int peakBytes = 0;
+	for (MemoryPool *pool = m_firstPoolInFactory; pool; pool = pool->getNextPoolInList())
+	{
+		peakBytes += pool->getPeakBlockCount() * pool->getAllocationSize();
+	}
+	return peakBytes;
+}
+
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+/**
+	give all blocks of the magazines of the given thread slot back to their blobs.
+*/
+void MemoryPoolFactory::flushMagazines(Int slot)
+{
+	for (MemoryPool *pool = m_firstPoolInFactory; pool; pool = pool->getNextPoolInList())
+	{
+		pool->flushMagazine(slot);
+	}
+}
+#endif
+
 //-----------------------------------------------------------------------------
 void MemoryPoolFactory::memoryPoolUsageReport( const char* filename, FILE *appendToFileInstead )
 {
@@ -3545,6 +3822,55 @@ void shutdownMemoryManager()
 	DEBUG_SHUTDOWN();
 }
 
+//-----------------------------------------------------------------------------
+void beginMemoryPoolMagazines()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	// the index stays allocated until the process exits, because threads may still read it.
+	if (theMagazineTlsIndex == TLS_OUT_OF_INDEXES)
+	{
+		theMagazineTlsIndex = TlsAlloc();
+		if (theMagazineTlsIndex == TLS_OUT_OF_INDEXES)
+			return;
+	}
+
+	if (getMagazineSlot() >= 0)
+		return;
+
+	for (Int i = 0; i < MAX_MEMORYPOOL_MAGAZINE_THREADS; ++i)
+	{
+		if (!theMagazineSlotInUse[i])
+		{
+			theMagazineSlotInUse[i] = true;
+			TlsSetValue(theMagazineTlsIndex, (void *)(size_t)(i + 1));
+			return;
+		}
+	}
+
+	// all slots are taken, so this thread takes the lock for every allocation.
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void endMemoryPoolMagazines()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	const Int slot = getMagazineSlot();
+	if (slot < 0)
+		return;
+
+	if (TheMemoryPoolFactory)
+		TheMemoryPoolFactory->flushMagazines(slot);
+
+	theMagazineSlotInUse[slot] = false;
+	TlsSetValue(theMagazineTlsIndex, nullptr);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 void* createW3DMemPool(const char *poolName, int allocationSize)
 {
@@ -66,6 +66,8 @@ static PoolSizeRec PoolSizes[] =
 	{ "PathNodePool", 8192, 1024 },
 	{ "PathPool", 256, 16 },
 	{ "WorkOrder", 32, 32 },
+	{ "JobPool", 256, 256 },
+	{ "JobSystemTestBlockPool", 256, 256 },
 	{ "TeamInQueue", 32, 32 },
 	{ "AIPlayer", 8, 8 },
 	{ "AISkirmishPlayer", 8, 8 },
@@ -496,6 +498,7 @@ static PoolSizeRec PoolSizes[] =
 	{ "Win32LocalFile", 1024, 256 },
 	{ "StdLocalFile", 1024, 256 },
 	{ "RAMFile", 32, 32 },
+	{ "MappedArchiveFile", 32, 32 },
 	{ "BattlePlanBonuses", 32, 32 },
 	{ "KindOfPercentProductionChange", 32, 32 },
 	{ "UserParser", 4096, 256 },
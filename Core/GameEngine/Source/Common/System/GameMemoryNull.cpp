@@ -89,6 +89,11 @@ void MemoryPoolFactory::memoryPoolUsageReport( const char* filename, FILE *appen
 {
 }
 
+Int MemoryPoolFactory::getPeakPoolBytes()
+{
+	return 0;
+}
+
 #ifdef MEMORYPOOL_DEBUG
 void MemoryPoolFactory::debugMemoryReport(Int flags, Int startCheckpoint, Int endCheckpoint, FILE *fp )
 {
@@ -155,6 +160,16 @@ void shutdownMemoryManager()
 	DEBUG_SHUTDOWN();
 }
 
+//-----------------------------------------------------------------------------
+void beginMemoryPoolMagazines()
+{
+}
+
+//-----------------------------------------------------------------------------
+void endMemoryPoolMagazines()
+{
+}
+
 
 #ifndef DISABLE_GAMEMEMORY_NEW_OPERATORS
 
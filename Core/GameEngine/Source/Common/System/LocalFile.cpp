@@ -82,7 +82,8 @@
 //         Private Data
 //----------------------------------------------------------------------------
 
-static Int s_totalOpen = 0;
+// TheSuperHackers @fix Files are also opened on job system workers, see ReplayCatalog.cpp
+static volatile long s_totalOpen = 0;
 
 //----------------------------------------------------------------------------
 //         Public Data
@@ -264,7 +265,7 @@ Bool LocalFile::open( const Char *filename, Int access, size_t bufferSize )
 
 #endif
 
-	++s_totalOpen;
+	InterlockedIncrement(&s_totalOpen);
 ///	DEBUG_LOG(("LocalFile::open %s (total %d)",filename,s_totalOpen));
 	if ( m_access & APPEND )
 	{
@@ -316,14 +317,14 @@ void LocalFile::closeFile()
 	{
 		fclose(m_file);
 		m_file = nullptr;
-		--s_totalOpen;
+		InterlockedDecrement(&s_totalOpen);
 	}
 #else
 	if( m_handle != -1 )
 	{
 		_close( m_handle );
 		m_handle = -1;
-		--s_totalOpen;
+		InterlockedDecrement(&s_totalOpen);
 	}
 #endif
 }
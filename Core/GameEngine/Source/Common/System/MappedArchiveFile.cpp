@@ -0,0 +1,116 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// MappedArchiveFile.cpp
+// Read only file view over archive data that is mapped into memory.
+
+#include "PreRTS.h"
+
+#include "Common/MappedArchiveFile.h"
+
+//=================================================================
+// MappedArchiveFile::MappedArchiveFile
+//=================================================================
+
+MappedArchiveFile::MappedArchiveFile()
+{
+}
+
+//=================================================================
+// MappedArchiveFile::~MappedArchiveFile
+//=================================================================
+
+MappedArchiveFile::~MappedArchiveFile()
+{
+	// The data belongs to the mapped archive. Prevent RAMFile from deleting it.
+	m_data = nullptr;
+}
+
+//=================================================================
+// MappedArchiveFile::open
+//=================================================================
+
+Bool MappedArchiveFile::open( File *file )
+{
+	DEBUG_CRASH(("MappedArchiveFile::open - use openFromMappedArchive instead"));
+	return FALSE;
+}
+
+//=================================================================
+// MappedArchiveFile::openFromArchive
+//=================================================================
+
+Bool MappedArchiveFile::openFromArchive(File *archiveFile, const AsciiString& filename, Int offset, Int size)
+{
+	DEBUG_CRASH(("MappedArchiveFile::openFromArchive - use openFromMappedArchive instead"));
+	return FALSE;
+}
+
+//=================================================================
+// MappedArchiveFile::openFromMappedArchive
+//=================================================================
+
+Bool MappedArchiveFile::openFromMappedArchive(const Char *data, const AsciiString& filename, Int size)
+{
+	if (data == nullptr) {
+		return FALSE;
+	}
+
+	if (File::open(filename.str(), File::READ | File::BINARY) == FALSE) {
+		return FALSE;
+	}
+
+	// The data is never written to, RAMFile::write is not supported.
+	m_data = const_cast<Char *>(data);
+	m_size = size;
+	m_pos = 0;
+	m_nameStr = filename;
+
+	return TRUE;
+}
+
+//=================================================================
+// MappedArchiveFile::close
+//=================================================================
+
+void MappedArchiveFile::close()
+{
+	m_data = nullptr;
+	RAMFile::close();
+}
+
+//=================================================================
+// MappedArchiveFile::readEntireAndClose
+//=================================================================
+
+char* MappedArchiveFile::readEntireAndClose()
+{
+	if (m_data == nullptr)
+	{
+		DEBUG_CRASH(("m_data is null in MappedArchiveFile::readEntireAndClose -- should not happen!"));
+		return NEW char[1];	// just to avoid crashing...
+	}
+
+	// The caller takes ownership of the returned buffer, so it needs its own copy.
+	char* tmp = MSGNEW("RAMFILE") char[m_size];
+	memcpy(tmp, m_data, m_size);
+
+	close();
+
+	return tmp;
+}
@@ -0,0 +1,225 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/XferDump.h"
+#include "Common/Snapshot.h"
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferDump::XferDump()
+{
+	m_xferMode = XFER_SAVE;
+	m_fileFP = nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferDump::~XferDump()
+{
+	if( m_fileFP != nullptr )
+	{
+		DEBUG_CRASH(( "Warning: Xfer file '%s' was left open", m_identifier.str() ));
+		close();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::open( AsciiString identifier )
+{
+	if( m_fileFP != nullptr )
+	{
+		DEBUG_CRASH(( "Cannot open file '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+	}
+
+	Xfer::open( identifier );
+
+	m_fileFP = fopen( identifier.str(), "wt" );
+	if( m_fileFP == nullptr )
+	{
+		DEBUG_LOG(( "XferDump - Cannot open file '%s'", identifier.str() ));
+		throw XFER_FILE_NOT_FOUND;
+	}
+
+	m_fieldIndices.clear();
+	m_fieldIndices.push_back( 0 );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::close()
+{
+	if( m_fileFP == nullptr )
+	{
+		DEBUG_CRASH(( "Xfer close called, but no file was open" ));
+		throw XFER_FILE_NOT_OPEN;
+	}
+
+	fclose( m_fileFP );
+	m_fileFP = nullptr;
+	m_identifier.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::beginSection( const AsciiString &name )
+{
+	DEBUG_ASSERTCRASH( m_fieldIndices.size() == 1, ("XferDump - section '%s' begins inside a block", name.str()) );
+
+	fprintf( m_fileFP, "[%s]\n", name.str() );
+	m_fieldIndices.resize( 1 );
+	m_fieldIndices[0] = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int XferDump::beginBlock()
+{
+	writeIndent();
+	fprintf( m_fileFP, "{\n" );
+	m_fieldIndices.push_back( 0 );
+	return XFER_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::endBlock()
+{
+	if( m_fieldIndices.size() <= 1 )
+	{
+		DEBUG_CRASH(( "Xfer end block called, but no matching begin block was found" ));
+		throw XFER_BEGIN_END_MISMATCH;
+	}
+
+	m_fieldIndices.pop_back();
+	writeIndent();
+	fprintf( m_fileFP, "}\n" );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::skip( Int dataSize )
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferSnapshot( Snapshot *snapshot )
+{
+	if( snapshot == nullptr )
+	{
+		DEBUG_CRASH(( "XferDump::xferSnapshot - Invalid parameters" ));
+		throw XFER_INVALID_PARAMETERS;
+	}
+
+	snapshot->xfer( this );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferBool( Bool *boolData )
+{
+	writeIndent();
+	fprintf( m_fileFP, "%d bool %d\n", nextFieldIndex(), *boolData ? 1 : 0 );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferInt( Int *intData )
+{
+	writeIndent();
+	fprintf( m_fileFP, "%d int %d\n", nextFieldIndex(), *intData );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferUnsignedInt( UnsignedInt *unsignedIntData )
+{
+	writeIndent();
+	fprintf( m_fileFP, "%d uint %u\n", nextFieldIndex(), *unsignedIntData );
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Reals are written with their bits as well, because a difference in the last bit is enough to desync */
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferReal( Real *realData )
+{
+	UnsignedInt bits;
+	memcpy( &bits, realData, sizeof( bits ) );
+	writeIndent();
+	fprintf( m_fileFP, "%d real %.9g %08X\n", nextFieldIndex(), *realData, bits );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferMarkerLabel( AsciiString asciiStringData )
+{
+	writeIndent();
+	fprintf( m_fileFP, "label \"%s\"\n", asciiStringData.str() );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferAsciiString( AsciiString *asciiStringData )
+{
+	writeIndent();
+	fprintf( m_fileFP, "string \"%s\"\n", asciiStringData->str() );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferUnicodeString( UnicodeString *unicodeStringData )
+{
+	AsciiString asciiString;
+	asciiString.translate( *unicodeStringData );
+	xferAsciiString( &asciiString );
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Anything that is not written with its type is written as bytes in hex */
+//-------------------------------------------------------------------------------------------------
+void XferDump::xferImplementation( void *data, Int dataSize )
+{
+	DEBUG_ASSERTCRASH( m_fileFP != nullptr, ("XferDump - file pointer for '%s' is null", m_identifier.str()) );
+
+	const UnsignedByte *bytes = static_cast<const UnsignedByte *>( data );
+	writeIndent();
+	fprintf( m_fileFP, "%d data[%d] ", nextFieldIndex(), dataSize );
+	for( Int i = 0; i < dataSize; ++i )
+		fprintf( m_fileFP, "%02X", bytes[i] );
+	fprintf( m_fileFP, "\n" );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferDump::writeIndent()
+{
+	for( size_t i = 1; i < m_fieldIndices.size(); ++i )
+		fputs( "  ", m_fileFP );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int XferDump::nextFieldIndex()
+{
+	return m_fieldIndices.back()++;
+}
@@ -0,0 +1,112 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/XferLoadBuffer.h"
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferLoadBuffer::XferLoadBuffer( const UnsignedByte *data, Int dataSize )
+{
+	m_data = data;
+	m_dataSize = dataSize;
+	m_position = 0;
+	m_isOpen = FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferLoadBuffer::~XferLoadBuffer()
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::open( AsciiString identifier )
+{
+	if( m_isOpen )
+	{
+		DEBUG_CRASH(( "Cannot open buffer '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+	}
+
+	// call base class of XferLoad, it would open a file
+	Xfer::open( identifier );
+
+	m_position = 0;
+	m_isOpen = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::close()
+{
+	if( !m_isOpen )
+	{
+		DEBUG_CRASH(( "Xfer close called, but no buffer was open" ));
+		throw XFER_FILE_NOT_OPEN;
+	}
+
+	m_isOpen = FALSE;
+	m_identifier.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int XferLoadBuffer::beginBlock()
+{
+	if( m_dataSize - m_position < (Int)sizeof( XferBlockSize ) )
+	{
+		DEBUG_CRASH(( "Xfer - Error reading block size for '%s'", m_identifier.str() ));
+		return 0;
+	}
+
+	XferBlockSize blockSize;
+	xferImplementation( &blockSize, sizeof( XferBlockSize ) );
+	return blockSize;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::skip( Int dataSize )
+{
+	DEBUG_ASSERTCRASH( dataSize >= 0, ("XferLoadBuffer::skip - dataSize '%d' must be greater than 0", dataSize) );
+
+	if( dataSize < 0 || dataSize > m_dataSize - m_position )
+		throw XFER_SKIP_ERROR;
+
+	m_position += dataSize;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferLoadBuffer::xferImplementation( void *data, Int dataSize )
+{
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferLoadBuffer - buffer '%s' is not open", m_identifier.str()) );
+
+	if( dataSize > m_dataSize - m_position )
+	{
+		DEBUG_CRASH(( "XferLoadBuffer - Error reading from buffer '%s'", m_identifier.str() ));
+		throw XFER_READ_ERROR;
+	}
+
+	memcpy( data, m_data + m_position, dataSize );
+	m_position += dataSize;
+}
@@ -0,0 +1,116 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2025 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/XferSaveBuffer.h"
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSaveBuffer::XferSaveBuffer()
+{
+	m_isOpen = FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSaveBuffer::~XferSaveBuffer()
+{
+	DEBUG_ASSERTCRASH( m_blockStack.empty(), ("XferSaveBuffer '%s' has unmatched begin blocks", m_identifier.str()) );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::open( AsciiString identifier )
+{
+	if( m_isOpen )
+	{
+		DEBUG_CRASH(( "Cannot open buffer '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+	}
+
+	// call base class of XferSave, it would open a file
+	Xfer::open( identifier );
+
+	m_buffer.clear();
+	m_blockStack.clear();
+	m_isOpen = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::close()
+{
+	if( !m_isOpen )
+	{
+		DEBUG_CRASH(( "Xfer close called, but no buffer was open" ));
+		throw XFER_FILE_NOT_OPEN;
+	}
+
+	m_isOpen = FALSE;
+	m_identifier.clear();
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int XferSaveBuffer::beginBlock()
+{
+	m_blockStack.push_back( m_buffer.size() );
+
+	// write a placeholder
+	XferBlockSize blockSize = 0;
+	xferImplementation( &blockSize, sizeof( XferBlockSize ) );
+
+	return XFER_OK;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::endBlock()
+{
+	if( m_blockStack.empty() )
+	{
+		DEBUG_CRASH(( "Xfer end block called, but no matching begin block was found" ));
+		throw XFER_BEGIN_END_MISMATCH;
+	}
+
+	const size_t blockPos = m_blockStack.back();
+	m_blockStack.pop_back();
+
+	XferBlockSize blockSize = (XferBlockSize)(m_buffer.size() - blockPos - sizeof( XferBlockSize ));
+	memcpy( &m_buffer[ blockPos ], &blockSize, sizeof( XferBlockSize ) );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::skip( Int dataSize )
+{
+	// XferSave moves the file position, which leaves zeros when it is at the end of the file
+	m_buffer.resize( m_buffer.size() + dataSize, 0 );
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::xferImplementation( void *data, Int dataSize )
+{
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferSaveBuffer - buffer '%s' is not open", m_identifier.str()) );
+
+	const UnsignedByte *bytes = static_cast<const UnsignedByte *>( data );
+	m_buffer.insert( m_buffer.end(), bytes, bytes + dataSize );
+}
@@ -69,12 +69,13 @@ WorkerProcess::WorkerProcess()
 {
 	m_processHandle = nullptr;
 	m_readHandle = nullptr;
+	m_stdInWriteHandle = nullptr;
 	m_jobHandle = nullptr;
 	m_exitcode = 0;
 	m_isDone = false;
 }
 
-bool WorkerProcess::startProcess(UnicodeString command)
+bool WorkerProcess::startProcess(UnicodeString command, bool redirectStdInput)
 {
 	m_stdOutput.clear();
 	m_isDone = false;
@@ -87,9 +88,24 @@ bool WorkerProcess::startProcess(UnicodeString command)
 		return false;
 	SetHandleInformation(m_readHandle, HANDLE_FLAG_INHERIT, 0);
 
+	// Create pipe for writing console input
+	HANDLE stdInReadHandle = nullptr;
+	if (redirectStdInput)
+	{
+		if (!CreatePipe(&stdInReadHandle, &m_stdInWriteHandle, &saAttr, 0))
+		{
+			CloseHandle(writeHandle);
+			CloseHandle(m_readHandle);
+			m_readHandle = nullptr;
+			return false;
+		}
+		SetHandleInformation(m_stdInWriteHandle, HANDLE_FLAG_INHERIT, 0);
+	}
+
 	STARTUPINFOW si = { sizeof(STARTUPINFOW) };
 	si.dwFlags = STARTF_FORCEOFFFEEDBACK; // Prevent cursor wait animation
 	si.dwFlags |= STARTF_USESTDHANDLES;
+	si.hStdInput = stdInReadHandle;
 	si.hStdError = writeHandle;
 	si.hStdOutput = writeHandle;
 
@@ -102,11 +118,18 @@ bool WorkerProcess::startProcess(UnicodeString command)
 		CloseHandle(writeHandle);
 		CloseHandle(m_readHandle);
 		m_readHandle = nullptr;
+		if (stdInReadHandle != nullptr)
+		{
+			CloseHandle(stdInReadHandle);
+			closeStdInput();
+		}
 		return false;
 	}
 
 	CloseHandle(pi.hThread);
 	CloseHandle(writeHandle);
+	if (stdInReadHandle != nullptr)
+		CloseHandle(stdInReadHandle);
 	m_processHandle = pi.hProcess;
 
 	// We want to make sure that when our process is killed, our workers automatically terminate as well.
@@ -143,6 +166,38 @@ AsciiString WorkerProcess::getStdOutput() const
 	return m_stdOutput;
 }
 
+void WorkerProcess::clearStdOutput()
+{
+	m_stdOutput.clear();
+}
+
+bool WorkerProcess::writeStdInput(const AsciiString& text)
+{
+	if (m_stdInWriteHandle == nullptr)
+		return false;
+
+	const char* buffer = text.str();
+	DWORD bytesLeft = text.getLength();
+	while (bytesLeft != 0)
+	{
+		DWORD writtenBytes = 0;
+		if (!WriteFile(m_stdInWriteHandle, buffer, bytesLeft, &writtenBytes, nullptr))
+			return false;
+		buffer += writtenBytes;
+		bytesLeft -= writtenBytes;
+	}
+	return true;
+}
+
+void WorkerProcess::closeStdInput()
+{
+	if (m_stdInWriteHandle != nullptr)
+	{
+		CloseHandle(m_stdInWriteHandle);
+		m_stdInWriteHandle = nullptr;
+	}
+}
+
 bool WorkerProcess::fetchStdOutput()
 {
 	while (true)
@@ -195,6 +250,8 @@ void WorkerProcess::update()
 	CloseHandle(m_readHandle);
 	m_readHandle = nullptr;
 
+	closeStdInput();
+
 	CloseHandle(m_jobHandle);
 	m_jobHandle = nullptr;
 
@@ -219,6 +276,8 @@ void WorkerProcess::kill()
 		m_readHandle = nullptr;
 	}
 
+	closeStdInput();
+
 	if (m_jobHandle != nullptr)
 	{
 		CloseHandle(m_jobHandle);
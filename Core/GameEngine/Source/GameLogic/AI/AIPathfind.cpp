@@ -34,6 +34,7 @@
 #include "Common/CRCDebug.h"
 #include "Common/GlobalData.h"
 #include "Common/LatchRestore.h"
+#include "Common/LogicProfiler.h"
 #include "Common/ThingTemplate.h"
 #include "Common/ThingFactory.h"
 
@@ -1118,6 +1119,7 @@ void PathfindCellInfo::forceCleanPathFindCellInfos()
 	for (Int i = 0; i < CELL_INFOS_TO_ALLOCATE - 1; i++) {
 		s_infoArray[i].m_nextOpen = nullptr;
 		s_infoArray[i].m_prevOpen = nullptr;
+		s_infoArray[i].m_openHeapIndex = -1;
 		s_infoArray[i].m_open = FALSE;
 		s_infoArray[i].m_closed = FALSE;
 	}
@@ -1207,6 +1209,8 @@ PathfindCellInfo *PathfindCellInfo::getACellInfo(PathfindCell *cell,const ICoord
 		info->m_pathParent = nullptr;
 		info->m_costSoFar = 0;
 		info->m_totalCost = 0;
+		info->m_openHeapIndex = -1;
+		info->m_openSequence = 0;
 		info->m_open = 0;
 		info->m_closed = 0;
 		info->m_obstacleID = INVALID_ID;
@@ -1235,12 +1239,80 @@ void PathfindCellInfo::releaseACellInfo(PathfindCellInfo *theInfo)
 
 //-----------------------------------------------------------------------------------
 
-Bool PathfindCellList::canReverseSort(PathfindCell& currentCell) const
+Bool PathfindCellList::heapLess(const PathfindCellInfo* a, const PathfindCellInfo* b)
 {
-	if (m_head && m_tail)
-		return m_head->getTotalCostDifference(currentCell) > m_tail->getTotalCostDifference(currentCell);
+	if (a->m_totalCost != b->m_totalCost)
+		return a->m_totalCost < b->m_totalCost;
 
-	return false;
+	// Equal costs are served in insertion order, like the sorted list inserted them after their equals.
+	return a->m_openSequence < b->m_openSequence;
+}
+
+void PathfindCellList::heapSiftUp(Int index)
+{
+	PathfindCellInfo* info = m_heap[index];
+	while (index > 0)
+	{
+		const Int parent = (index - 1) / 2;
+		if (!heapLess(info, m_heap[parent]))
+			break;
+
+		m_heap[index] = m_heap[parent];
+		m_heap[index]->m_openHeapIndex = index;
+		index = parent;
+	}
+	m_heap[index] = info;
+	info->m_openHeapIndex = index;
+}
+
+void PathfindCellList::heapSiftDown(Int index)
+{
+	const Int count = (Int)m_heap.size();
+	PathfindCellInfo* info = m_heap[index];
+	for (;;)
+	{
+		Int child = index * 2 + 1;
+		if (child >= count)
+			break;
+
+		if (child + 1 < count && heapLess(m_heap[child + 1], m_heap[child]))
+			++child;
+
+		if (!heapLess(m_heap[child], info))
+			break;
+
+		m_heap[index] = m_heap[child];
+		m_heap[index]->m_openHeapIndex = index;
+		index = child;
+	}
+	m_heap[index] = info;
+	info->m_openHeapIndex = index;
+}
+
+void PathfindCellList::heapPush(PathfindCellInfo* info)
+{
+	info->m_openSequence = m_nextSequence++;
+	m_heap.push_back(info);
+	heapSiftUp((Int)m_heap.size() - 1);
+}
+
+void PathfindCellList::heapRemove(PathfindCellInfo* info)
+{
+	const Int index = info->m_openHeapIndex;
+	DEBUG_ASSERTCRASH(index >= 0 && index < (Int)m_heap.size() && m_heap[index] == info, ("Cell is not in the open list heap."));
+
+	info->m_openHeapIndex = -1;
+	PathfindCellInfo* last = m_heap.back();
+	m_heap.pop_back();
+	if (last == info)
+		return;
+
+	// The removed cell may have had its cost changed already, so only the moved cell is compared.
+	m_heap[index] = last;
+	if (index > 0 && heapLess(last, m_heap[(index - 1) / 2]))
+		heapSiftUp(index);
+	else
+		heapSiftDown(index);
 }
 
 //-----------------------------------------------------------------------------------
@@ -1301,6 +1373,7 @@ Bool PathfindCell::startPathfind( PathfindCell *goalCell  )
 	m_info->m_nextOpen = nullptr;
 	m_info->m_prevOpen = nullptr;
 	m_info->m_pathParent = nullptr;
+	m_info->m_openHeapIndex = -1;
 	m_info->m_costSoFar = 0;		// start node, no cost to get here
 	m_info->m_totalCost = 0;
 	if (goalCell) {
@@ -1348,18 +1421,6 @@ inline void PathfindCell::setBlockedByAlly(Bool blocked)
 #endif
 }
 
-/**
- * Determine absolute total path cost difference between two cells.
- * Returns UINT_MAX if used with an uninitialised cell, so will be sorted as maximally dissimilar.
- */
-inline UnsignedInt PathfindCell::getTotalCostDifference(PathfindCell& other) const
-{
-	if (m_info && other.m_info)
-		return abs((Int)m_info->m_totalCost - (Int)other.m_info->m_totalCost);
-
-	return UINT_MAX;
-}
-
 /**
  * Set the parent pointer.
  */
@@ -1756,55 +1817,16 @@ void PathfindCell::forwardInsertionSortRetailCompatible(PathfindCellList& list)
 }
 #endif
 
-// Forward insertion sort, returns early if the list is being initialized or we are prepending the list
-void PathfindCell::forwardInsertionSort(PathfindCellList& list)
+/// put self on "open" list in ascending cost order, return new list
+void PathfindCell::putOnSortedOpenList( PathfindCellList &list )
 {
-	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
-	DEBUG_ASSERTCRASH(m_info->m_closed == FALSE && m_info->m_open == FALSE, ("Serious error - Invalid flags. jba"));
-
-	// mark the new cell as being on the open list
-	m_info->m_open = true;
-	m_info->m_closed = false;
-
-	if (list.m_head == nullptr) {
-		m_info->m_prevOpen = nullptr;
-		m_info->m_nextOpen = nullptr;
-		list.m_head = this;
-		list.m_tail = this;
-		return;
-	}
-
-	// If the node needs inserting before the current list head
-	if (m_info->m_totalCost < list.m_head->m_info->m_totalCost) {
-		m_info->m_prevOpen = nullptr;
-		list.m_head->m_info->m_prevOpen = this->m_info;
-		m_info->m_nextOpen = list.m_head->m_info;
-		list.m_head = this;
+#if RETAIL_COMPATIBLE_PATHFINDING
+	if (!s_useFixedPathfinding) {
+		forwardInsertionSortRetailCompatible(list);
 		return;
 	}
+#endif
 
-	// Traverse the list to find correct position
-	PathfindCell* current = list.m_head;
-	while (current->m_info->m_nextOpen && current->m_info->m_nextOpen->m_totalCost <= m_info->m_totalCost) {
-		current = current->getNextOpen();
-	}
-
-	// Insert the new node in the correct position
-	m_info->m_nextOpen = current->m_info->m_nextOpen;
-	if (current->m_info->m_nextOpen != nullptr) {
-		current->m_info->m_nextOpen->m_prevOpen = this->m_info;
-	}
-	else {
-		list.m_tail = this;
-	}
-
-	current->m_info->m_nextOpen = this->m_info;
-	m_info->m_prevOpen = current->m_info;
-}
-
-// Reverse insertion sort, returns early if the list is being initialized or we are appending the list
-void PathfindCell::reverseInsertionSort(PathfindCellList& list)
-{
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed == FALSE && m_info->m_open == FALSE, ("Serious error - Invalid flags. jba"));
 
@@ -1812,61 +1834,18 @@ void PathfindCell::reverseInsertionSort(PathfindCellList& list)
 	m_info->m_open = true;
 	m_info->m_closed = false;
 
-	if (list.m_tail == nullptr) {
-		m_info->m_prevOpen = nullptr;
-		m_info->m_nextOpen = nullptr;
-		list.m_tail = this;
-		list.m_head = this;
-		return;
-	}
-
-	// If the node needs inserting after the current list tail
-	if (m_info->m_totalCost >= list.m_tail->m_info->m_totalCost) {
-		m_info->m_prevOpen = list.m_tail->m_info;
+	// append to the list, the heap orders the cells by cost
+	m_info->m_nextOpen = nullptr;
+	m_info->m_prevOpen = list.m_tail ? list.m_tail->m_info : nullptr;
+	if (list.m_tail) {
 		list.m_tail->m_info->m_nextOpen = this->m_info;
-		m_info->m_nextOpen = nullptr;
-		list.m_tail = this;
-		return;
-	}
-
-	// Traverse the list to find correct position
-	PathfindCell* current = list.m_tail;
-	while (current->m_info->m_prevOpen && current->m_info->m_prevOpen->m_totalCost > m_info->m_totalCost) {
-		current = current->getPrevOpen();
-	}
-
-	// Insert the new node in the correct position
-	m_info->m_prevOpen = current->m_info->m_prevOpen;
-	if (current->m_info->m_prevOpen != nullptr) {
-		current->m_info->m_prevOpen->m_nextOpen = this->m_info;
 	}
 	else {
 		list.m_head = this;
 	}
+	list.m_tail = this;
 
-	current->m_info->m_prevOpen = this->m_info;
-	m_info->m_nextOpen = current->m_info;
-}
-
-/// put self on "open" list in ascending cost order, return new list
-void PathfindCell::putOnSortedOpenList( PathfindCellList &list )
-{
-#if RETAIL_COMPATIBLE_PATHFINDING
-	if (!s_useFixedPathfinding) {
-		forwardInsertionSortRetailCompatible(list);
-		return;
-	}
-#endif
-
-	// TheSuperHackers @performance Mauller 20/03/2026 Implement reverse insertion sorting.
-	// Long and complex paths often append PathfindCell's, with high total path costs, to the open list.
-	// Appending and reverse traversal allow faster insertion of these cells, reducing pathfinding overhead by 50 - 66%.
-	if (list.canReverseSort(*this)) {
-		reverseInsertionSort(list);
-	}
-	else {
-		forwardInsertionSort(list);
-	}
+	list.heapPush(m_info);
 }
 
 /// remove self from "open" list
@@ -1874,6 +1853,9 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+	if (m_info->m_openHeapIndex >= 0)
+		list.heapRemove(m_info);
+
 	if (m_info->m_nextOpen)
 		m_info->m_nextOpen->m_prevOpen = m_info->m_prevOpen;
 	else {
@@ -1921,6 +1903,7 @@ Int PathfindCell::releaseOpenList( PathfindCellList &list )
 		DEBUG_ASSERTCRASH(cur == curInfo->m_cell, ("Bad backpointer in PathfindCellInfo"));
 		curInfo->m_nextOpen = nullptr;
 		curInfo->m_prevOpen = nullptr;
+		curInfo->m_openHeapIndex = -1;
 		curInfo->m_open = FALSE;
 		cur->releaseInfo();
 	}
@@ -1972,6 +1955,7 @@ void PathfindCell::putOnClosedList( PathfindCellList &list )
 	{
 		m_info->m_closed = FALSE;
 		m_info->m_closed = TRUE;
+		LOGIC_PROFILE_COUNT(COUNTER_PATHFIND_CELLS_EXPANDED, 1);
 
 		m_info->m_prevOpen = nullptr;
 		m_info->m_nextOpen = list.m_head ? list.m_head->m_info : nullptr;
@@ -2330,6 +2314,40 @@ inline void applyZone(PathfindCell &targetCell, const PathfindCell &sourceCell,
 
 }
 
+// TheSuperHackers @performance The cell zones of a full zone calculation are merged with a union-find
+// instead of resolveZones, which rewrote the whole equivalency array on every merge and made the full
+// calculation quadratic in the number of zones. Each zone links to a lower zone, so the root of a zone
+// is the lowest zone it is merged with, which is the same zone resolveZones kept.
+inline Int findZoneRoot(zoneStorageType *zoneParents, Int zone)
+{
+	while (zoneParents[zone] != zone) {
+		zoneParents[zone] = zoneParents[zoneParents[zone]];
+		zone = zoneParents[zone];
+	}
+	return zone;
+}
+
+inline void applyZoneUnion(PathfindCell &targetCell, const PathfindCell &sourceCell, zoneStorageType *zoneParents)
+{
+	DEBUG_ASSERTCRASH(sourceCell.getZone()!=0, ("Unset source zone."));
+	Int srcZone = findZoneRoot(zoneParents, sourceCell.getZone());
+	Int targetZone = findZoneRoot(zoneParents, targetCell.getZone());
+
+	if (targetZone == 0) {
+		targetCell.setZone(srcZone);
+		return;
+	}
+	if (targetZone == srcZone) {
+		return; // already match.
+	}
+	// Keep the lower zone.
+	if (targetZone < srcZone) {
+		zoneParents[srcZone] = targetZone;
+	} else {
+		zoneParents[targetZone] = srcZone;
+	}
+}
+
 inline void applyBlockZone(PathfindCell &targetCell, const PathfindCell &sourceCell,
 													 zoneStorageType *zoneEquivalency, Int firstZone, Int sizeOfZE)
 {
@@ -2725,12 +2743,12 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 
 					if (i>bounds.lo.x) {
 						if (map[i][j].getType() == map[i-1][j].getType()) {
-							applyZone(map[i][j], map[i-1][j], zoneEquivalency, m_maxZone);
+							applyZoneUnion(map[i][j], map[i-1][j], zoneEquivalency);
 						}
 					}
 					if (j>bounds.lo.y) {
 						if (map[i][j].getType() == map[i][j-1].getType()) {
-							applyZone(map[i][j], map[i][j-1], zoneEquivalency, m_maxZone);
+							applyZoneUnion(map[i][j], map[i][j-1], zoneEquivalency);
 						}
 					}
 					if (cell->getZone()==0) {
@@ -2754,6 +2772,11 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 
 	Int totalZones = m_maxZone;
 
+	// Point every zone directly at its root. Parents are always lower zones, so one ascending pass does it.
+	for (i=1; i<totalZones; i++) {
+		zoneEquivalency[i] = zoneEquivalency[zoneEquivalency[i]];
+	}
+
 	// Collapse the zones into a 1,2,3... sequence, removing collapsed zones.
 	m_maxZone = 1;
 	Int collapsedZones[maxZones];
@@ -4083,6 +4106,7 @@ void Pathfinder::reset()
 	}
 	m_queuePRHead = 0;
 	m_queuePRTail = 0;
+	m_queuedPathfindRequestSlots.clear();
 
 	m_numWallPieces = 0;
 	for (i=0; i<MAX_WALL_PIECES; ++i)
@@ -4893,7 +4917,7 @@ void Pathfinder::debugShowSearch(  Bool pathFound  )
 		addIcon(nullptr, 0, 0, color);	 // erase.
 	}
 
-	for( s = m_openList.getHead(); s; s=s->getNextOpen() )
+	for( s = m_openList.getFirst(); s; s=s->getNextOpen() )
 	{
 		// create objects to show path - they decay
 		RGBColor color;
@@ -5519,6 +5543,7 @@ Bool Pathfinder::adjustToLandingDestination(Object *obj, Coord3D *dest)
  */
 Bool Pathfinder::adjustDestination(Object *obj, const LocomotorSet& locomotorSet, Coord3D *dest, const Coord3D *groupDest)
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "adjustDestination");
 	if( obj->isKindOf(KINDOF_PROJECTILE) )
 	{
 		return true; // missiles can go wherever they want to. jba.
@@ -5825,15 +5850,11 @@ Bool Pathfinder::queueForPath(ObjectID id)
 #endif
 
 	/* Check & see if we are already queued. */
-	Int slot = m_queuePRHead;
-	while (slot != m_queuePRTail) {
-		if (m_queuedPathfindRequests[slot] == id) {
-			return true;
-		}
-		slot++;
-		if (slot >= PATHFIND_QUEUE_LEN) {
-			slot = 0;
-		}
+	// TheSuperHackers @performance The queued objects are tracked in a hash map, because scanning the
+	// queue for every request made ordering a large group of units quadratic in the group size.
+	if (m_queuedPathfindRequestSlots.find(id) != m_queuedPathfindRequestSlots.end()) {
+		DEBUG_ASSERTCRASH(m_queuedPathfindRequests[m_queuedPathfindRequestSlots[id]] == id, ("Pathfind queue slot mismatch."));
+		return true;
 	}
 
 	// Tail is the first available slot.
@@ -5846,6 +5867,7 @@ Bool Pathfinder::queueForPath(ObjectID id)
 		return false;
 	}
 	m_queuedPathfindRequests[m_queuePRTail] = id;
+	m_queuedPathfindRequestSlots[id] = m_queuePRTail;
 	m_queuePRTail = nextSlot;
 	return true;
 }
@@ -6039,6 +6061,7 @@ Path *Pathfinder::getAircraftPath( const Object *obj, const Coord3D *to )
 //DECLARE_PERF_TIMER(processPathfindQueue)
 void Pathfinder::processPathfindQueue()
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "processPathfindQueue");
 	//USE_PERF_TIMER(processPathfindQueue)
 	if (!m_isMapReady) {
 		return;
@@ -6076,6 +6099,7 @@ void Pathfinder::processPathfindQueue()
 	while (m_cumulativeCellsAllocated < PATHFIND_CELLS_PER_FRAME &&
 		m_queuePRTail!=m_queuePRHead) {
 		Object *obj = TheGameLogic->findObjectByID(m_queuedPathfindRequests[m_queuePRHead]);
+		m_queuedPathfindRequestSlots.erase(m_queuedPathfindRequests[m_queuePRHead]);
 		m_queuedPathfindRequests[m_queuePRHead] = INVALID_ID;
 		if (obj) {
 			AIUpdateInterface *ai = obj->getAIUpdateInterface();
@@ -6297,15 +6321,27 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 
 		UnsignedInt newCostSoFar = 0;
 
+		// TheSuperHackers @performance The parent cell coordinates and layer live in the shared cell
+		// info and do not change while its neighbors are examined, so they are fetched once instead of
+		// being reloaded through the info pointer for every neighbor. The same goes for the parent
+		// ground height, which is only looked up once the first neighbor needs it.
+		const ICoord2D parentCellCoord = { parentCell->getXIndex(), parentCell->getYIndex() };
+		const PathfindLayerEnum parentLayer = parentCell->getLayer();
+		Coord3D parentPos;
+		parentPos.x = parentCellCoord.x * PATHFIND_CELL_SIZE_F;
+		parentPos.y = parentCellCoord.y * PATHFIND_CELL_SIZE_F;
+		parentPos.z = 0.0f;
+		Bool hasParentHeight = false;
+
 		for( int i=0; i<numNeighbors; i++ )
 		{
 			neighborFlags[i] = false;
 			// determine neighbor cell to try
-			newCellCoord.x = parentCell->getXIndex() + delta[i].x;
-			newCellCoord.y = parentCell->getYIndex() + delta[i].y;
+			newCellCoord.x = parentCellCoord.x + delta[i].x;
+			newCellCoord.y = parentCellCoord.y + delta[i].y;
 
 			// get the neighboring cell
-			newCell = getCell(parentCell->getLayer(), newCellCoord.x, newCellCoord.y );
+			newCell = getCell(parentLayer, newCellCoord.x, newCellCoord.y );
 
 			// check if cell is on the map
 			if (!newCell)
@@ -6335,10 +6371,11 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 			// do the gravity check here
 			if ( locomotorSet.isDownhillOnly() )
 			{
-				Coord3D fromPos;
-				fromPos.x = parentCell->getXIndex() * PATHFIND_CELL_SIZE_F ;
-				fromPos.y = parentCell->getYIndex() * PATHFIND_CELL_SIZE_F ;
-				fromPos.z = TheTerrainLogic->getGroundHeight(fromPos.x , fromPos.y);
+				if (!hasParentHeight) {
+					parentPos.z = TheTerrainLogic->getGroundHeight(parentPos.x, parentPos.y);
+					hasParentHeight = true;
+				}
+				const Coord3D& fromPos = parentPos;
 
 				Coord3D toPos;
 				toPos.x = newCellCoord.x * PATHFIND_CELL_SIZE_F ;
@@ -6368,7 +6405,7 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 
 			TCheckMovementInfo info;
 			info.cell = newCellCoord;
-			info.layer = parentCell->getLayer();
+			info.layer = parentLayer;
 			info.centerInCell = centerInCell;
 			info.radius = radius;
 			info.considerTransient = false;
@@ -6405,10 +6442,11 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 			}
 
 			if (newCell->getType() == PathfindCell::CELL_CLIFF && !newCell->getPinched() ) {
-				Coord3D fromPos;
-				fromPos.x = parentCell->getXIndex() * PATHFIND_CELL_SIZE_F ;
-				fromPos.y = parentCell->getYIndex() * PATHFIND_CELL_SIZE_F ;
-				fromPos.z = TheTerrainLogic->getGroundHeight(fromPos.x , fromPos.y);
+				if (!hasParentHeight) {
+					parentPos.z = TheTerrainLogic->getGroundHeight(parentPos.x, parentPos.y);
+					hasParentHeight = true;
+				}
+				const Coord3D& fromPos = parentPos;
 
 				Coord3D toPos;
 				toPos.x = newCellCoord.x * PATHFIND_CELL_SIZE_F ;
@@ -6499,6 +6537,7 @@ Int Pathfinder::examineNeighboringCells(PathfindCell *parentCell, PathfindCell *
 Path *Pathfinder::findPath( Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
 													 const Coord3D *rawTo)
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "findPath");
 	if (!clientSafeQuickDoesPathExist(locomotorSet, from, rawTo)) {
 		return nullptr;
 	}
@@ -7109,6 +7148,7 @@ struct GroundCellsStruct
 Path *Pathfinder::findGroundPath( const Coord3D *from,
 													 const Coord3D *rawTo, Int pathDiameter, Bool crusher)
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "findGroundPath");
 	//CRCDEBUG_LOG(("Pathfinder::findGroundPath()"));
 #ifdef DEBUG_LOGGING
 	Int startTimeMS = ::GetTickCount();
@@ -8369,6 +8409,7 @@ Bool Pathfinder::slowDoesPathExist( Object *obj,
 																const Coord3D *to,
 																ObjectID ignoreObject)
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "slowDoesPathExist");
 	AIUpdateInterface *ai = obj->getAI();
 	if (ai==nullptr) {
 		return false;
@@ -8725,6 +8766,7 @@ Int Pathfinder::checkPathCost(Object *obj, const LocomotorSet& locomotorSet, con
 Path *Pathfinder::findClosestPath( Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
 																	Coord3D *rawTo, Bool blocked, Real pathCostMultiplier, Bool moveAllies)
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "findClosestPath");
 	//CRCDEBUG_LOG(("Pathfinder::findClosestPath()"));
 #ifdef DEBUG_LOGGING
 	Int startTimeMS = ::GetTickCount();
@@ -10544,6 +10586,7 @@ Path *Pathfinder::getMoveAwayFromPath(Object* obj, Object *otherObj,
 Path *Pathfinder::patchPath( const Object *obj, const LocomotorSet& locomotorSet,
 		Path *originalPath, Bool blocked )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "patchPath");
 	//CRCDEBUG_LOG(("Pathfinder::patchPath()"));
 #ifdef DEBUG_LOGGING
 	Int startTimeMS = ::GetTickCount();
@@ -10773,6 +10816,7 @@ Path *Pathfinder::patchPath( const Object *obj, const LocomotorSet& locomotorSet
 Path *Pathfinder::findAttackPath( const Object *obj, const LocomotorSet& locomotorSet, const Coord3D *from,
 		const Object *victim, const Coord3D* victimPos, const Weapon *weapon )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "findAttackPath");
 	if (!m_isMapReady)
 		return nullptr; // Should always be ok.
 
@@ -11128,6 +11172,7 @@ Path *Pathfinder::findAttackPath( const Object *obj, const LocomotorSet& locomot
 Path *Pathfinder::findSafePath( const Object *obj, const LocomotorSet& locomotorSet,
 		const Coord3D *from, const Coord3D* repulsorPos1, const Coord3D* repulsorPos2, Real repulsorRadius)
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PATHFINDER, "findSafePath");
 	//CRCDEBUG_LOG(("Pathfinder::findSafePath()"));
 	if (m_isMapReady == false) return nullptr; // Should always be ok.
 #if defined(RTS_DEBUG)
@@ -51,5 +51,5 @@ public:
 
 	virtual Bool loadBigFilesFromDirectory(AsciiString dir, AsciiString fileMask, Bool overwrite = FALSE) override;
 protected:
-
+	virtual ArchiveFile * createArchiveFile(const Char *filename);		///< Factory for the archive file objects of this file system
 };
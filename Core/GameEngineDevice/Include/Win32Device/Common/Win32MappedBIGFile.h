@@ -0,0 +1,48 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/////// Win32MappedBIGFile.h ////////////////////////////////////
+// BIG file that serves read only files directly from a memory mapping of the archive.
+/////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <windows.h>
+
+#include "Win32Device/Common/Win32BIGFile.h"
+
+class Win32MappedBIGFile : public Win32BIGFile
+{
+	public:
+		Win32MappedBIGFile(AsciiString name, AsciiString path);
+		virtual ~Win32MappedBIGFile() override;
+
+		virtual File*					openFile( const Char *filename, Int access = 0 ) override;///< Open the specified file within the BIG file
+		virtual void					close() override;													///< Close this BIG file
+
+	protected:
+
+		Bool					mapArchive();				///< Map the archive into memory if not done yet. Returns false if it cannot be mapped.
+		void					unmapArchive();
+
+		HANDLE				m_fileHandle;				///< Handle of the archive file on disk
+		HANDLE				m_mappingHandle;		///< Handle of the file mapping object
+		const Char *	m_mappedData;				///< Start of the mapped archive
+		UnsignedInt		m_mappedSize;				///< Size of the mapped archive
+		Bool					m_mappingFailed;		///< Mapping was attempted and failed, do not try again
+};
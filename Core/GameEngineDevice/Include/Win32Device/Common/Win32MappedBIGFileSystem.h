@@ -0,0 +1,38 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//////// Win32MappedBIGFileSystem.h ///////////////////////////
+// BIG file system that maps the archives into memory instead of copying each opened file.
+/////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Win32Device/Common/Win32BIGFileSystem.h"
+
+// TheSuperHackers @performance Read only files opened from the archives of this file system
+// reference the mapped archive memory directly instead of allocating and copying a RAMFile.
+// Streaming and write access still go through the regular Win32BIGFile code path.
+class Win32MappedBIGFileSystem : public Win32BIGFileSystem
+{
+public:
+	Win32MappedBIGFileSystem();
+	virtual ~Win32MappedBIGFileSystem() override;
+
+protected:
+	virtual ArchiveFile * createArchiveFile(const Char *filename) override;
+};
@@ -86,8 +86,6 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 	Int archiveFileSize = 0;
 	Int numLittleFiles = 0;
 
-	ArchiveFile *archiveFile = NEW StdBIGFile(filename, AsciiString::TheEmptyString);
-
 	DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - opening BIG file %s", filename));
 
 	if (fp == nullptr) {
@@ -95,8 +93,7 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 		return nullptr;
 	}
 
-	AsciiString asciibuf;
-	char buffer[_MAX_PATH];
+	char buffer[5];
 	fp->read(buffer, 4); // read the "BIG" at the beginning of the file.
 	buffer[4] = 0;
 	if (strcmp(buffer, BIGFileIdentifier) != 0) {
@@ -125,61 +122,33 @@ ArchiveFile * StdBIGFileSystem::openArchiveFile(const Char *filename) {
 //		buffer[(4-i)-1] = t;
 //	}
 
-	// seek to the beginning of the directory listing.
-	fp->seek(0x10, File::START);
-	// read in each directory listing.
-	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
-
-	for (Int i = 0; i < numLittleFiles; ++i) {
-		Int filesize = 0;
-		Int fileOffset = 0;
-		fp->read(&fileOffset, 4);
-		fp->read(&filesize, 4);
-
-		filesize = betoh(filesize);
-		fileOffset = betoh(fileOffset);
-
-		fileInfo->m_archiveFilename = archiveFileName;
-		fileInfo->m_offset = fileOffset;
-		fileInfo->m_size = filesize;
-
-		// read in the path name of the file.
-		Int pathIndex = -1;
-		do {
-			++pathIndex;
-			fp->read(buffer + pathIndex, 1);
-		} while (buffer[pathIndex] != 0);
-
-		Int filenameIndex = pathIndex;
-		while ((filenameIndex >= 0) && (buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/')) {
-			--filenameIndex;
-		}
-
-		fileInfo->m_filename = (char *)(buffer + filenameIndex + 1);
-		fileInfo->m_filename.toLower();
-		buffer[filenameIndex + 1] = 0;
-
-		AsciiString path;
-		path = buffer;
+	// read in the offset of the first file, which is the end of the directory listing.
+	Int directoryEnd = 0;
+	fp->read(&directoryEnd, 4);
+	directoryEnd = betoh(directoryEnd);
 
-		AsciiString debugpath;
-		debugpath = path;
-		debugpath.concat(fileInfo->m_filename);
-//		DEBUG_LOG(("StdBIGFileSystem::openArchiveFile - adding file %s to archive file %s, file number %d", debugpath.str(), fileInfo->m_archiveFilename.str(), i));
+	ArchiveFile *archiveFile = createArchiveFile(filename);
 
-		archiveFile->addFile(path, fileInfo);
+	// TheSuperHackers @performance Read the directory listing in one block instead of byte by byte.
+	if (!loadBIGFileDirectory(fp, archiveFileName, numLittleFiles, directoryEnd, archiveFile)) {
+		DEBUG_CRASH(("Error reading BIG file directory in file %s", filename));
+		delete archiveFile;
+		fp->close();
+		fp = nullptr;
+		return nullptr;
 	}
 
 	archiveFile->attachFile(fp);
 
-	delete fileInfo;
-	fileInfo = nullptr;
-
 	// leave fp open as the archive file will be using it.
 
 	return archiveFile;
 }
 
+ArchiveFile * StdBIGFileSystem::createArchiveFile(const Char *filename) {
+	return NEW StdBIGFile(filename, AsciiString::TheEmptyString);
+}
+
 void StdBIGFileSystem::closeArchiveFile(const Char *filename) {
 	// Need to close the specified big file
 	ArchiveFileMap::iterator it =  m_archiveFileMap.find(filename);
@@ -209,6 +178,12 @@ void StdBIGFileSystem::closeAllFiles() {
 
 Bool StdBIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fileMask, Bool overwrite) {
 
+#ifdef DEBUG_LOGGING
+	// TheSuperHackers @info Startup benchmark for loading the archive directories
+	const DWORD startTimeMillis = GetTickCount();
+	Int numArchives = 0;
+#endif
+
 	FilenameList filenameList;
 	TheLocalFileSystem->getFileListInDirectory(dir, "", fileMask, filenameList, TRUE);
 
@@ -233,10 +208,15 @@ Bool StdBIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fi
 			m_archiveFileMap[(*it)] = archiveFile;
 			DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.", (*it).str()));
 			actuallyAdded = TRUE;
+#ifdef DEBUG_LOGGING
+			++numArchives;
+#endif
 		}
 
 		it++;
 	}
 
+	DEBUG_LOG(("StdBIGFileSystem::loadBigFilesFromDirectory - loaded %d archives from '%s' in %u ms", numArchives, dir.str(), GetTickCount() - startTimeMillis));
+
 	return actuallyAdded;
 }
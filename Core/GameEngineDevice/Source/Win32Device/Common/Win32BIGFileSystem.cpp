@@ -94,8 +94,7 @@ ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
 		return nullptr;
 	}
 
-	AsciiString asciibuf;
-	char buffer[_MAX_PATH];
+	char buffer[5];
 	fp->read(buffer, 4); // read the "BIG" at the beginning of the file.
 	buffer[4] = 0;
 	if (strcmp(buffer, BIGFileIdentifier) != 0) {
@@ -124,63 +123,34 @@ ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
 //		buffer[(4-i)-1] = t;
 //	}
 
-	// seek to the beginning of the directory listing.
-	fp->seek(0x10, File::START);
-	// read in each directory listing.
-	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
-	// TheSuperHackers @fix Mauller 23/04/2025 Create new file handle when necessary to prevent memory leak
-	ArchiveFile *archiveFile = NEW Win32BIGFile(filename, AsciiString::TheEmptyString);
-
-	for (Int i = 0; i < numLittleFiles; ++i) {
-		Int filesize = 0;
-		Int fileOffset = 0;
-		fp->read(&fileOffset, 4);
-		fp->read(&filesize, 4);
-
-		filesize = betoh(filesize);
-		fileOffset = betoh(fileOffset);
-
-		fileInfo->m_archiveFilename = archiveFileName;
-		fileInfo->m_offset = fileOffset;
-		fileInfo->m_size = filesize;
-
-		// read in the path name of the file.
-		Int pathIndex = -1;
-		do {
-			++pathIndex;
-			fp->read(buffer + pathIndex, 1);
-		} while (buffer[pathIndex] != 0);
-
-		Int filenameIndex = pathIndex;
-		while ((filenameIndex >= 0) && (buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/')) {
-			--filenameIndex;
-		}
-
-		fileInfo->m_filename = (char *)(buffer + filenameIndex + 1);
-		fileInfo->m_filename.toLower();
-		buffer[filenameIndex + 1] = 0;
-
-		AsciiString path;
-		path = buffer;
+	// read in the offset of the first file, which is the end of the directory listing.
+	Int directoryEnd = 0;
+	fp->read(&directoryEnd, 4);
+	directoryEnd = betoh(directoryEnd);
 
-		AsciiString debugpath;
-		debugpath = path;
-		debugpath.concat(fileInfo->m_filename);
-//		DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - adding file %s to archive file %s, file number %d", debugpath.str(), fileInfo->m_archiveFilename.str(), i));
+	// TheSuperHackers @fix Mauller 23/04/2025 Create new file handle when necessary to prevent memory leak
+	ArchiveFile *archiveFile = createArchiveFile(filename);
 
-		archiveFile->addFile(path, fileInfo);
+	// TheSuperHackers @performance Read the directory listing in one block instead of byte by byte.
+	if (!loadBIGFileDirectory(fp, archiveFileName, numLittleFiles, directoryEnd, archiveFile)) {
+		DEBUG_CRASH(("Error reading BIG file directory in file %s", filename));
+		delete archiveFile;
+		fp->close();
+		fp = nullptr;
+		return nullptr;
 	}
 
 	archiveFile->attachFile(fp);
 
-	delete fileInfo;
-	fileInfo = nullptr;
-
 	// leave fp open as the archive file will be using it.
 
 	return archiveFile;
 }
 
+ArchiveFile * Win32BIGFileSystem::createArchiveFile(const Char *filename) {
+	return NEW Win32BIGFile(filename, AsciiString::TheEmptyString);
+}
+
 void Win32BIGFileSystem::closeArchiveFile(const Char *filename) {
 	// Need to close the specified big file
 	ArchiveFileMap::iterator it =  m_archiveFileMap.find(filename);
@@ -210,6 +180,12 @@ void Win32BIGFileSystem::closeAllFiles() {
 
 Bool Win32BIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString fileMask, Bool overwrite) {
 
+#ifdef DEBUG_LOGGING
+	// TheSuperHackers @info Startup benchmark for loading the archive directories
+	const DWORD startTimeMillis = GetTickCount();
+	Int numArchives = 0;
+#endif
+
 	FilenameList filenameList;
 	TheLocalFileSystem->getFileListInDirectory(dir, "", fileMask, filenameList, TRUE);
 
@@ -234,10 +210,15 @@ Bool Win32BIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString
 			m_archiveFileMap[(*it)] = archiveFile;
 			DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.", (*it).str()));
 			actuallyAdded = TRUE;
+#ifdef DEBUG_LOGGING
+			++numArchives;
+#endif
 		}
 
 		it++;
 	}
 
+	DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - loaded %d archives from '%s' in %u ms", numArchives, dir.str(), GetTickCount() - startTimeMillis));
+
 	return actuallyAdded;
 }
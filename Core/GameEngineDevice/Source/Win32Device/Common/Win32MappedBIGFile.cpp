@@ -0,0 +1,178 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+////// Win32MappedBIGFile.cpp /////////////////////////
+// BIG file that serves read only files directly from a memory mapping of the archive.
+/////////////////////////////////////////////////////
+
+#include <windows.h>
+#include "Common/ArchiveFileSystem.h"
+#include "Common/GameMemory.h"
+#include "Common/MappedArchiveFile.h"
+#include "Win32Device/Common/Win32MappedBIGFile.h"
+
+namespace
+{
+// The archives of the game do not all fit into the address space of a 32 bit process at the same time.
+// Archives are mapped on first use until this budget is used up, the remaining ones copy files as before.
+const UnsignedInt MaxTotalMappedBytes = sizeof(void*) > 4 ? 0xFFFFFFFFu : 512u * 1024u * 1024u;
+
+UnsignedInt s_totalMappedBytes = 0;
+}
+
+//============================================================================
+// Win32MappedBIGFile::Win32MappedBIGFile
+//============================================================================
+
+Win32MappedBIGFile::Win32MappedBIGFile(AsciiString name, AsciiString path)
+	: Win32BIGFile(name, path)
+	, m_fileHandle(INVALID_HANDLE_VALUE)
+	, m_mappingHandle(nullptr)
+	, m_mappedData(nullptr)
+	, m_mappedSize(0)
+	, m_mappingFailed(FALSE)
+{
+}
+
+//============================================================================
+// Win32MappedBIGFile::~Win32MappedBIGFile
+//============================================================================
+
+Win32MappedBIGFile::~Win32MappedBIGFile()
+{
+	unmapArchive();
+}
+
+//============================================================================
+// Win32MappedBIGFile::openFile
+//============================================================================
+
+File* Win32MappedBIGFile::openFile( const Char *filename, Int access )
+{
+	if (BitIsSet(access, File::STREAMING) || BitIsSet(access, File::WRITE)) {
+		return Win32BIGFile::openFile(filename, access);
+	}
+
+	const ArchivedFileInfo *fileInfo = getArchivedFileInfo(AsciiString(filename));
+
+	if (fileInfo == nullptr) {
+		return nullptr;
+	}
+
+	if (!mapArchive()) {
+		return Win32BIGFile::openFile(filename, access);
+	}
+
+	if (fileInfo->m_offset + fileInfo->m_size > m_mappedSize) {
+		DEBUG_CRASH(("File %s exceeds the size of archive %s", filename, m_name.str()));
+		return nullptr;
+	}
+
+	MappedArchiveFile *mappedFile = newInstance( MappedArchiveFile );
+	mappedFile->deleteOnClose();
+	if (mappedFile->openFromMappedArchive(m_mappedData + fileInfo->m_offset, fileInfo->m_filename, fileInfo->m_size) == FALSE) {
+		mappedFile->close();
+		return nullptr;
+	}
+
+	return mappedFile;
+}
+
+//============================================================================
+// Win32MappedBIGFile::close
+//============================================================================
+
+void Win32MappedBIGFile::close()
+{
+	unmapArchive();
+	Win32BIGFile::close();
+}
+
+//============================================================================
+// Win32MappedBIGFile::mapArchive
+//============================================================================
+
+Bool Win32MappedBIGFile::mapArchive()
+{
+	if (m_mappedData != nullptr) {
+		return TRUE;
+	}
+
+	if (m_mappingFailed) {
+		return FALSE;
+	}
+
+	// Only try once. Failing here is not an error, files are then copied like in Win32BIGFile.
+	m_mappingFailed = TRUE;
+
+	m_fileHandle = CreateFileA(m_name.str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (m_fileHandle == INVALID_HANDLE_VALUE) {
+		return FALSE;
+	}
+
+	DWORD sizeHigh = 0;
+	const DWORD sizeLow = GetFileSize(m_fileHandle, &sizeHigh);
+	if (sizeLow == INVALID_FILE_SIZE || sizeHigh != 0 || sizeLow == 0 || sizeLow > MaxTotalMappedBytes - s_totalMappedBytes) {
+		unmapArchive();
+		return FALSE;
+	}
+
+	m_mappingHandle = CreateFileMappingA(m_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_mappingHandle == nullptr) {
+		unmapArchive();
+		return FALSE;
+	}
+
+	m_mappedData = static_cast<const Char *>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (m_mappedData == nullptr) {
+		unmapArchive();
+		return FALSE;
+	}
+
+	m_mappedSize = sizeLow;
+	s_totalMappedBytes += m_mappedSize;
+	m_mappingFailed = FALSE;
+
+	DEBUG_LOG(("Win32MappedBIGFile::mapArchive - mapped %s, %u bytes, %u bytes mapped in total", m_name.str(), m_mappedSize, s_totalMappedBytes));
+
+	return TRUE;
+}
+
+//============================================================================
+// Win32MappedBIGFile::unmapArchive
+//============================================================================
+
+void Win32MappedBIGFile::unmapArchive()
+{
+	if (m_mappedData != nullptr) {
+		UnmapViewOfFile(m_mappedData);
+		m_mappedData = nullptr;
+		s_totalMappedBytes -= m_mappedSize;
+		m_mappedSize = 0;
+	}
+
+	if (m_mappingHandle != nullptr) {
+		CloseHandle(m_mappingHandle);
+		m_mappingHandle = nullptr;
+	}
+
+	if (m_fileHandle != INVALID_HANDLE_VALUE) {
+		CloseHandle(m_fileHandle);
+		m_fileHandle = INVALID_HANDLE_VALUE;
+	}
+}
@@ -0,0 +1,36 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//////// Win32MappedBIGFileSystem.cpp ///////////////////////////
+// BIG file system that maps the archives into memory instead of copying each opened file.
+/////////////////////////////////////////////////////////////////
+
+#include "Common/GameMemory.h"
+
+#include "Win32Device/Common/Win32MappedBIGFile.h"
+#include "Win32Device/Common/Win32MappedBIGFileSystem.h"
+
+Win32MappedBIGFileSystem::Win32MappedBIGFileSystem() : Win32BIGFileSystem() {
+}
+
+Win32MappedBIGFileSystem::~Win32MappedBIGFileSystem() {
+}
+
+ArchiveFile * Win32MappedBIGFileSystem::createArchiveFile(const Char *filename) {
+	return NEW Win32MappedBIGFile(filename, AsciiString::TheEmptyString);
+}
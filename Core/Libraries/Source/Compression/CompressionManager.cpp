@@ -137,8 +137,12 @@ Int CompressionManager::getMaxCompressedSize( Int uncompressedLen, CompressionTy
 
 		case COMPRESSION_BTREE:   // guessing here
 		case COMPRESSION_HUFF:    // guessing here
-		case COMPRESSION_REFPACK: // guessing here
 			return uncompressedLen + 8;
+
+		// TheSuperHackers @fix RefPack does not check the size of its output, and data that does not
+		// compress grows by its header, a literal code for every run of literals and the end code.
+		case COMPRESSION_REFPACK:
+			return uncompressedLen + uncompressedLen / 64 + 16 + 8;
 		case COMPRESSION_ZLIB1:
 		case COMPRESSION_ZLIB2:
 		case COMPRESSION_ZLIB3:
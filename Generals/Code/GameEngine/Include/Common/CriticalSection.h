@@ -38,13 +38,17 @@ class CriticalSection
 {
 	CRITICAL_SECTION m_windowsCriticalSection;
 
+	// TheSuperHackers @performance Threads that find the section taken spin for a short while before
+	// waiting in the kernel. The sections guard short operations such as memory pool allocations.
+	enum { SPIN_COUNT = 4000 };
+
 	public:
 		CriticalSection()
 		{
 			#ifdef PERF_TIMERS
 			AutoPerfGather a(TheCritSecPerfGather);
 			#endif
-			InitializeCriticalSection( &m_windowsCriticalSection );
+			InitializeCriticalSectionAndSpinCount( &m_windowsCriticalSection, SPIN_COUNT );
 		}
 
 		virtual ~CriticalSection()
@@ -73,6 +77,8 @@ class CriticalSection
 		}
 };
 
+// TheSuperHackers @performance The destructor is not virtual, because the class is never derived from
+// and it is constructed for every memory pool and dynamic memory allocation.
 class ScopedCriticalSection
 {
 	private:
@@ -85,7 +91,7 @@ class ScopedCriticalSection
 				m_cs->enter();
 		}
 
-		virtual ~ScopedCriticalSection()
+		~ScopedCriticalSection()
 		{
 			if (m_cs)
 				m_cs->exit();
@@ -93,6 +93,14 @@ typedef ObjectPtrHash::const_iterator ObjectPtrIter;
 
 typedef std::vector<Object*> ObjectPtrVector;
 
+// TheSuperHackers @performance An entry of the sleepy update priority queue. The priority is stored next to
+// the module, so that sifting the queue compares contiguous keys instead of dereferencing scattered modules.
+struct SleepyUpdateEntry
+{
+	UnsignedInt priority;		///< copy of module->friend_getPriority(); must be refreshed whenever that changes
+	UpdateModulePtr module;
+};
+
 // ------------------------------------------------------------------------------------------------
 /**
  * The implementation of GameLogic
@@ -285,6 +293,7 @@ private:
 	Int rebalanceChildSleepyUpdate(Int i);
 	void remakeSleepyUpdate();
 	void validateSleepyUpdate() const;
+	void refreshSleepyUpdatePriority(UpdateModulePtr u);
 
 private:
 
@@ -337,7 +346,7 @@ private:
 	// never modify it directly; please use the proper access methods.
 	// (for an excellent discussion of priority queues, please see:
 	// http://dogma.net/markn/articles/pq_stl/priority.htm)
-	std::vector<UpdateModulePtr> m_sleepyUpdates;
+	std::vector<SleepyUpdateEntry> m_sleepyUpdates;
 
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	// this is a plain old list, not a pq.
@@ -1219,6 +1219,24 @@ private:
 #ifdef FASTER_GCO
 	Int							m_maxGcoRadius;
 	RadiusVec				m_radiusVec;
+
+	// TheSuperHackers @performance The objects around a cell, in the order getClosestObjects visits them.
+	// Objects only enter or leave cells in update() or when they are removed from the partition, so the
+	// lists stay valid for all the queries in between. Distances and filters are still evaluated per query.
+	struct GcoCellCache
+	{
+		UnsignedInt					epoch;		///< m_gcoCellCacheEpoch at the time the lists were built
+		Int									builtRadius;
+		std::vector<Object*>	objects;
+		std::vector<Int>		ringEnds;	///< end of each radius in objects
+	};
+	typedef std::vector<GcoCellCache>	GcoCellCacheVec;
+
+	GcoCellCacheVec	m_gcoCellCaches;				///< indexed like m_cells, allocated on first use
+	UnsignedInt			m_gcoCellCacheEpoch;
+	Bool						m_gcoCellCachesDirty;		///< set when any cell gained or lost an object
+	Int							m_gcoIterFlag;
+	std::vector<Object*>	m_gcoScratchObjects;
 #endif
 
 protected:
@@ -1256,6 +1274,8 @@ protected:
 #ifdef FASTER_GCO
 	Int calcMinRadius(const ICoord2D& cur);
 	void calcRadiusVec();
+	void appendGcoObjects(Int cellCenterX, Int cellCenterY, Int curRadius, Int iterFlag, std::vector<Object*>& objects);
+	const GcoCellCache* findGcoCellCache(Int cellCenterX, Int cellCenterY, Int maxRadius, Bool allowBuild);
 #endif
 
 	// These are all friend functions now. They will continue to function as before, but can be passed into
@@ -1431,6 +1451,10 @@ public:
 	*/
 	Bool isClearLineOfSightTerrain(const Object* obj, const Coord3D& objPos, const Object* other, const Coord3D& otherPos);
 
+#ifdef FASTER_GCO
+	void friend_notifyCellContentsChanged() { m_gcoCellCachesDirty = true; }	///< this is only for use by PartitionCell
+#endif
+
 	Bool isInListDirtyModules(PartitionData* o) const
 	{
 		return o->isInListDirtyModules(&m_dirtyModules);
@@ -465,6 +465,88 @@ Int parseJobs(char *args[], int num)
 	return 1;
 }
 
+Int parsePersistentJobs(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayPersistentJobs = TRUE;
+	return parseJobs(args, num);
+}
+
+Int parseReplayWorker(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayWorker = TRUE;
+	return 1;
+}
+
+Int parseLogicProfile(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_logicProfileFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplayCheckpoints(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_replayCheckpointInterval = atoi(args[1]);
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySeek(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_replaySeekFrame = atoi(args[1]);
+		return 2;
+	}
+	return 1;
+}
+
+Int parseDesyncTrace(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_desyncTraceFile = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseDesyncDump(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_desyncDumpFrame = atoi(args[1]);
+		return 2;
+	}
+	return 1;
+}
+
+Int parseBuildReplayCatalog(char *args[], int num)
+{
+	TheWritableGlobalData->m_buildReplayCatalog = TRUE;
+	TheWritableGlobalData->m_playIntro = FALSE;
+	TheWritableGlobalData->m_afterIntro = TRUE;
+	TheWritableGlobalData->m_playSizzle = FALSE;
+	TheWritableGlobalData->m_shellMapOn = FALSE;
+	return 1;
+}
+
+Int parseTestJobSystem(char *args[], int num)
+{
+	TheWritableGlobalData->m_testJobSystem = TRUE;
+	TheWritableGlobalData->m_playIntro = FALSE;
+	TheWritableGlobalData->m_afterIntro = TRUE;
+	TheWritableGlobalData->m_playSizzle = FALSE;
+	TheWritableGlobalData->m_shellMapOn = FALSE;
+	return 1;
+}
+
 Int parseXRes(char *args[], int num)
 {
 	if (num > 1)
@@ -1155,6 +1237,45 @@ static CommandLineParam paramsForStartup[] =
 	// (If you have 4 cores, call it with -jobs 4)
 	// If you do not call this, all replays will be simulated in sequence in the same process.
 	{ "-jobs", parseJobs },
+
+	// TheSuperHackers @feature Same as -jobs, but each process initializes the engine only once and then
+	// simulates one replay after another. This avoids the engine startup cost for every single replay.
+	// Currently only supported together with -headless.
+	{ "-persistentJobs", parsePersistentJobs },
+
+	// TheSuperHackers @info Used internally by -persistentJobs. After simulating the replays passed with -replay,
+	// the process reads more replay filenames from stdin, one per line, until stdin is closed or an empty line is read.
+	{ "-replayWorker", parseReplayWorker },
+
+	// TheSuperHackers @feature Profile the game logic of the replays simulated in this process and write
+	// the report to <path>.json and a collapsed stack file for flamegraphs to <path>.folded. Best used with -headless.
+	// Pass the path without extension afterwards. Not supported together with -jobs.
+	{ "-logicProfile", parseLogicProfile },
+
+	// TheSuperHackers @feature Write a checkpoint of the replays simulated in this process every <interval> logic frames.
+	// The checkpoints are written to a .rck file next to each replay. Pass the interval afterwards, for example 9000.
+	{ "-replayCheckpoints", parseReplayCheckpoints },
+
+	// TheSuperHackers @feature Continue the replays simulated in this process from their last checkpoint at or before
+	// <frame> instead of simulating them from the start. Pass the frame afterwards. Used with -headless.
+	{ "-replaySeek", parseReplaySeek },
+
+	// TheSuperHackers @feature Write the GameLogic CRC of every frame of the replays simulated in this process to <path>,
+	// to compare it with the trace of another build or option set. Pass the path afterwards. Used with -headless.
+	// Not supported together with -jobs.
+	{ "-desyncTrace", parseDesyncTrace },
+
+	// TheSuperHackers @feature Dump the logic state at <frame> to the path of -desyncTrace with the extension .dump
+	// added, and stop the simulation there. Pass the frame afterwards.
+	{ "-desyncDump", parseDesyncDump },
+
+	// TheSuperHackers @feature Read the headers of all replays in the replay folder into ReplayCatalog.ini and exit.
+	// The headers are read in parallel. Used with -headless.
+	{ "-buildReplayCatalog", parseBuildReplayCatalog },
+
+	// TheSuperHackers @feature Stress test the job system, print the results and exit with 1 if a test failed.
+	// Used with -headless.
+	{ "-testJobSystem", parseTestJobSystem },
 };
 
 // These Params are parsed during Engine Init before INI data is loaded
@@ -41,6 +41,7 @@
 #include "Common/GameEngine.h"
 #include "Common/INI.h"
 #include "Common/INIException.h"
+#include "Common/JobSystem.h"
 #include "Common/MessageStream.h"
 #include "Common/ThingFactory.h"
 #include "Common/file.h"
@@ -61,6 +62,7 @@
 #include "Common/DamageFX.h"
 #include "Common/MultiplayerSettings.h"
 #include "Common/Recorder.h"
+#include "Common/ReplayCatalog.h"
 #include "Common/SpecialPower.h"
 #include "Common/TerrainTypes.h"
 #include "Common/Upgrade.h"
@@ -265,6 +267,9 @@ GameEngine::~GameEngine()
 	delete TheMapCache;
 	TheMapCache = nullptr;
 
+	delete TheReplayCatalog;
+	TheReplayCatalog = nullptr;
+
 //	delete TheShell;
 //	TheShell = nullptr;
 
@@ -382,6 +387,9 @@ void GameEngine::init()
 		XferCRC xferCRC;
 		xferCRC.open("lightCRC");
 
+		// TheSuperHackers @feature Comes first so that every other subsystem can run jobs.
+		initSubsystem(TheJobSystem, "TheJobSystem", MSGNEW("GameEngineSubsystem") JobSystem, nullptr);
+
 		initSubsystem(TheLocalFileSystem, "TheLocalFileSystem", createLocalFileSystem(), nullptr);
 		initSubsystem(TheArchiveFileSystem, "TheArchiveFileSystem", createArchiveFileSystem(), nullptr); // this MUST come after TheLocalFileSystem creation
 
@@ -530,6 +538,9 @@ void GameEngine::init()
 		TheMapCache = MSGNEW("GameEngineSubsystem") MapCache;
 		TheMapCache->updateCache();
 
+		// TheSuperHackers @performance The replay catalog is updated when the replay list is shown.
+		TheReplayCatalog = MSGNEW("GameEngineSubsystem") ReplayCatalog;
+
 		if (TheGlobalData->m_buildMapCache)
 		{
 			// just quit, since the map cache has already updated
@@ -748,6 +759,9 @@ void GameEngine::update()
 			}
 		}
 
+		// TheSuperHackers @performance Tells the user when a save file written in the background is done
+		TheGameState->UPDATE();
+
 		const Bool canUpdate = canUpdateGameLogic();
 		const Bool canUpdateLogic = canUpdate && !TheFramePacer->isGameHalted() && !TheFramePacer->isTimeFrozen();
 		const Bool canUpdateScript = canUpdate && !TheFramePacer->isGameHalted();
@@ -30,6 +30,8 @@
 
 #include "Common/FramePacer.h"
 #include "Common/GameEngine.h"
+#include "Common/JobSystemTest.h"
+#include "Common/ReplayCatalog.h"
 #include "Common/ReplaySimulation.h"
 
 
@@ -49,6 +51,15 @@ Int GameMain()
 	{
 		exitcode = ReplaySimulation::simulateReplays(TheGlobalData->m_simulateReplays, TheGlobalData->m_simulateReplayJobs);
 	}
+	else if (TheGlobalData->m_buildReplayCatalog)
+	{
+		const Int validReplays = TheReplayCatalog->rebuildCatalog();
+		printf("Cataloged %d valid replays in %s\n", validReplays, RecorderClass::getReplayDir().str());
+	}
+	else if (TheGlobalData->m_testJobSystem)
+	{
+		exitcode = JobSystemTest::run();
+	}
 	else
 	{
 		// run it
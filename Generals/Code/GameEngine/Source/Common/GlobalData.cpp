@@ -956,6 +956,9 @@ GlobalData::GlobalData()
 	m_showMoneyPerMinute = FALSE;
 	m_allowMoneyPerMinuteForPlayer = FALSE;
 
+	m_compressSaveGames = TRUE;
+	m_incrementalSaveGames = FALSE;
+
 	m_debugShowGraphicalFramerate = FALSE;
 
 	// By default, show all asserts.
@@ -986,6 +989,15 @@ GlobalData::GlobalData()
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplayPersistentJobs = FALSE;
+	m_simulateReplayWorker = FALSE;
+	m_logicProfileFile.clear();
+	m_replayCheckpointInterval = 0;
+	m_replaySeekFrame = 0;
+	m_desyncTraceFile.clear();
+	m_desyncDumpFrame = -1;
+	m_buildReplayCatalog = FALSE;
+	m_testJobSystem = FALSE;
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
@@ -1209,6 +1221,9 @@ void GlobalData::parseGameDataDefinition( INI* ini )
 	TheWritableGlobalData->m_playerInfoListFontSize = optionPref.getPlayerInfoListFontSize();
 	TheWritableGlobalData->m_showMoneyPerMinute = optionPref.getShowMoneyPerMinute();
 
+	TheWritableGlobalData->m_compressSaveGames = optionPref.getCompressSaveGames();
+	TheWritableGlobalData->m_incrementalSaveGames = optionPref.getIncrementalSaveGames();
+
 	TheWritableGlobalData->m_antiAliasLevel = optionPref.getAntiAliasing();
 	TheWritableGlobalData->m_textureFilteringMode = optionPref.getTextureFilterMode();
 	TheWritableGlobalData->m_textureAnisotropyLevel = optionPref.getTextureAnisotropyLevel();
@@ -39,10 +39,12 @@
 #include "Common/PlayerList.h"
 #include "Common/RandomValue.h"
 #include "Common/Radar.h"
+#include "Common/SaveGameFile.h"
 #include "Common/Team.h"
 #include "Common/WellKnownKeys.h"
 #include "Common/XferLoad.h"
-#include "Common/XferSave.h"
+#include "Common/XferLoadBuffer.h"
+#include "Common/XferSaveBuffer.h"
 #include "GameClient/CampaignManager.h"
 #include "GameClient/GadgetListBox.h"
 #include "GameClient/GameClient.h"
@@ -278,6 +280,8 @@ GameState::GameState()
 	m_availableGames = nullptr;
 	m_isInLoadGame = FALSE;
 
+	m_saveGameFile = NEW SaveGameFile;
+
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -295,6 +299,10 @@ GameState::~GameState()
 	// clear any available game
 	clearAvailableGames();
 
+	// wait for the last save file to be written
+	delete m_saveGameFile;
+	m_saveGameFile = nullptr;
+
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -346,10 +354,64 @@ void GameState::reset()
 	// clear any available game
 	clearAvailableGames();
 
+	// the blocks of the last save are of no use in another game
+	finishSaveGameWrite();
+	m_saveGameFile->clearPreviousBlocks();
+
 	m_isInLoadGame = FALSE;
 
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Tell the user once the save file written in the background is done */
+// ------------------------------------------------------------------------------------------------
+void GameState::update()
+{
+
+	if( m_writingSaveGamePath.isNotEmpty() && m_saveGameFile->isWriting() == FALSE )
+		finishSaveGameWrite();
+
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Wait for the save file to be written and tell the user whether it was */
+// ------------------------------------------------------------------------------------------------
+void GameState::finishSaveGameWrite()
+{
+
+	const Bool succeeded = m_saveGameFile->waitForWrite();
+
+	// report every write once
+	if( m_writingSaveGamePath.isEmpty() )
+		return;
+
+	AsciiString filepath = m_writingSaveGamePath;
+	m_writingSaveGamePath.clear();
+
+	if( succeeded )
+	{
+
+		// print message to the user for game successfully saved
+		UnicodeString msg = TheGameText->fetch( "GUI:GameSaveComplete" );
+		TheInGameUI->message( msg );
+
+	}
+	else
+	{
+
+		// the previous save file, if any, was kept
+		UnicodeString ufilepath;
+		ufilepath.translate(filepath);
+
+		UnicodeString msg;
+		msg.format( TheGameText->fetch("GUI:ErrorSavingGame"), ufilepath.str() );
+
+		MessageBoxOk(TheGameText->fetch("GUI:Error"), msg, nullptr);
+
+	}
+
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Clear any available games entries */
 // ------------------------------------------------------------------------------------------------
@@ -547,6 +609,9 @@ SaveCode GameState::saveGame( AsciiString filename, UnicodeString desc,
 
 	}
 
+	// report the previous save before starting another one
+	finishSaveGameWrite();
+
 	// make absolutely sure the save directory exists
 	CreateDirectory( getSaveDirectory().str(), nullptr );
 
@@ -556,16 +621,12 @@ SaveCode GameState::saveGame( AsciiString filename, UnicodeString desc,
 	// save description as current description in the game state
 	m_gameInfo.description = desc;
 
-	// open the save file
-	XferSave xferSave;
-	try {
-		xferSave.open( filepath );
-	} catch(...) {
-		// print error message to the user
-		TheInGameUI->message( "GUI:Error" );
-		DEBUG_LOG(( "Error opening file '%s'", filepath.str() ));
-		return SC_ERROR;
-	}
+	//
+	// TheSuperHackers @performance The game is saved into memory, and the save file is then
+	// compressed and written in the background, so the game only waits for the serialisation
+	//
+	XferSaveBuffer xferSave;
+	xferSave.open( filepath );
 
 	// save our save file type
 	SaveGameInfo *gameInfo = getSaveGameInfo();
@@ -600,23 +661,65 @@ SaveCode GameState::saveGame( AsciiString filename, UnicodeString desc,
 
 		MessageBoxOk(TheGameText->fetch("GUI:Error"), msg, nullptr);
 
-		// close the file and get out of here
+		// close the buffer and get out of here
 		xferSave.close();
 		return SC_ERROR;
 
 	}
 
-	// close the file
+	// close the buffer
 	xferSave.close();
 
-	// print message to the user for game successfully saved
-	UnicodeString msg = TheGameText->fetch( "GUI:GameSaveComplete" );
-	TheInGameUI->message( msg );
+	// write the save file
+	if( m_saveGameFile->write( filepath, xferSave.getBuffer(),
+														 TheGlobalData->m_compressSaveGames, TheGlobalData->m_incrementalSaveGames ) == FALSE )
+	{
+		// print error message to the user
+		TheInGameUI->message( "GUI:Error" );
+		DEBUG_LOG(( "Error opening file '%s'", filepath.str() ));
+		return SC_ERROR;
+	}
+
+	// the user is told that the game was saved once the file is written, see update()
+	m_writingSaveGamePath = filepath;
 
 	return SC_OK;
 
 }
 
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature Save the current state of the engine into memory. Unlike saveGame
+	* this shows no messages to the user, so it can be used while simulating replays. */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::saveGameToBuffer( std::vector<UnsignedByte> &buffer )
+{
+
+	SaveGameInfo *gameInfo = getSaveGameInfo();
+	gameInfo->saveFileType = SAVE_FILE_TYPE_NORMAL;
+	gameInfo->missionMapName.clear();
+
+	XferSaveBuffer xferSave;
+	try
+	{
+
+		xferSave.open( "SaveGameBuffer" );
+		xferSaveData( &xferSave, SNAPSHOT_SAVELOAD );
+		xferSave.close();
+
+	}
+	catch( ... )
+	{
+
+		DEBUG_LOG(( "GameState::saveGameToBuffer - Error saving game" ));
+		return SC_ERROR;
+
+	}
+
+	buffer.swap( xferSave.getBuffer() );
+	return SC_OK;
+
+}
+
 // ------------------------------------------------------------------------------------------------
 /** A mission save */
 // ------------------------------------------------------------------------------------------------
@@ -667,8 +770,23 @@ SaveCode GameState::loadGame( AvailableGameInfo gameInfo )
 	// construct path to file
 	AsciiString filepath = getFilePathInSaveDirectory(gameInfo.filename);
 
-	// open the save file
-	XferLoad xferLoad;
+	// read the save file, compressed save files are decompressed
+	std::vector<UnsignedByte> saveData;
+	if( SaveGameFile::readFile( filepath, saveData ) == FALSE || saveData.empty() )
+	{
+		UnicodeString ufilepath;
+		ufilepath.translate(filepath);
+
+		UnicodeString msg;
+		msg.format( TheGameText->fetch("GUI:ErrorLoadingGame"), ufilepath.str() );
+
+		MessageBoxOk(TheGameText->fetch("GUI:Error"), msg, nullptr);
+
+		return SC_INVALID_DATA;
+	}
+
+	// open the save data
+	XferLoadBuffer xferLoad( &saveData[0], (Int)saveData.size() );
 	xferLoad.open( filepath );
 
 	// clear out the game engine
@@ -693,7 +811,7 @@ SaveCode GameState::loadGame( AvailableGameInfo gameInfo )
 		error = TRUE;
 	}
 
-	// close the file
+	// close the save data
 	xferLoad.close();
 
 	// un-savelock the ghost objects
@@ -757,6 +875,68 @@ SaveCode GameState::loadGame( AvailableGameInfo gameInfo )
 
 }
 
+// ------------------------------------------------------------------------------------------------
+/** TheSuperHackers @feature Load a game saved with saveGameToBuffer. The engine must have been
+	* reset before. On error the game data is cleared and no messages are shown to the user. */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::loadGameFromBuffer( const UnsignedByte *data, Int dataSize )
+{
+
+	//
+	// clear the save directory of any temporary "scratch pad" maps that were extracted
+	// from any previously loaded save game files
+	//
+	TheGameStateMap->clearScratchPadMaps();
+
+	// lock creation of new ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( TRUE );
+
+	LatchRestore<Bool> inLoadGame(m_isInLoadGame, TRUE);
+
+	// load the save data
+	Bool error = FALSE;
+	XferLoadBuffer xferLoad( data, dataSize );
+	try
+	{
+
+		xferLoad.open( "SaveGameBuffer" );
+		xferSaveData( &xferLoad, SNAPSHOT_SAVELOAD );
+		xferLoad.close();
+
+	}
+	catch( ... )
+	{
+		error = TRUE;
+	}
+
+	// un-savelock the ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( FALSE );
+
+	try
+	{
+		// do the post-process from a save game load
+		gameStatePostProcessLoad();
+	}
+	catch (...)
+	{
+		error = TRUE;
+	}
+
+	if( error == TRUE )
+	{
+
+		DEBUG_LOG(( "GameState::loadGameFromBuffer - Error loading game" ));
+		if (TheGameLogic->isInGame())
+			TheGameLogic->clearGameData( FALSE );
+		TheGameEngine->reset();
+		return SC_INVALID_DATA;
+
+	}
+
+	return SC_OK;
+
+}
+
 //-------------------------------------------------------------------------------------------------
 AsciiString GameState::getSaveDirectory() const
 {
@@ -930,6 +1110,9 @@ AsciiString GameState::portableMapPathToRealMapPath(const AsciiString& in) const
 Bool GameState::doesSaveGameExist( AsciiString filename )
 {
 
+	// the file may still be written
+	finishSaveGameWrite();
+
 	// construct full path to file
 	AsciiString filepath = getFilePathInSaveDirectory(filename);
 
@@ -976,8 +1159,16 @@ void GameState::getSaveGameInfoFromFile( AsciiString filename, SaveGameInfo *sav
 
 	}
 
-	// open file for partial loading
-	XferLoad xferLoad;
+	// the file may still be written
+	finishSaveGameWrite();
+
+	// TheSuperHackers @performance Read only the first block of the file, which holds the game info
+	std::vector<UnsignedByte> saveData;
+	if( SaveGameFile::readFile( filename, saveData, 1 ) == FALSE || saveData.empty() )
+		throw SC_INVALID_DATA;
+
+	// open the data for partial loading
+	XferLoadBuffer xferLoad( &saveData[0], (Int)saveData.size() );
 	xferLoad.open( filename );
 
 	//
@@ -1057,7 +1248,7 @@ void GameState::getSaveGameInfoFromFile( AsciiString filename, SaveGameInfo *sav
 
 	}
 
-	// close the file
+	// close the data
 	xferLoad.close();
 
 }
@@ -1244,6 +1435,9 @@ void GameState::iterateSaveFiles( IterateSaveFileCallback callback, void *userDa
 	if( callback == nullptr )
 		return;
 
+	// the last save file may still be written
+	finishSaveGameWrite();
+
 	// save the current directory
 	char currentDirectory[ _MAX_PATH ];
 	GetCurrentDirectory( _MAX_PATH, currentDirectory );
@@ -36,6 +36,7 @@
 #include "Common/GameEngine.h"
 #include "Common/GameState.h"
 #include "Common/Recorder.h"
+#include "Common/ReplayCatalog.h"
 #include "Common/version.h"
 #include "GameClient/WindowLayout.h"
 #include "GameClient/Gadget.h"
@@ -105,6 +106,20 @@ UnicodeString GetReplayFilenameFromListbox(GameWindow *listbox, Int index)
 
 //-------------------------------------------------------------------------------------------------
 
+static Bool readReplayMapInfo(const RecorderClass::ReplayHeader &header, ReplayGameInfo &info, const MapMetaData *&mapData)
+{
+	if (ParseAsciiStringToGameInfo(&info, header.gameOptions))
+	{
+		if (TheMapCache != nullptr)
+			mapData = TheMapCache->findMap(info.getMap());
+		else
+			mapData = nullptr;
+
+		return true;
+	}
+	return false;
+}
+
 static Bool readReplayMapInfo(const AsciiString& filename, RecorderClass::ReplayHeader &header, ReplayGameInfo &info, const MapMetaData *&mapData)
 {
 	header.forPlayback = FALSE;
@@ -112,21 +127,29 @@ static Bool readReplayMapInfo(const AsciiString& filename, RecorderClass::Replay
 
 	if (TheRecorder != nullptr && TheRecorder->readReplayHeader(header))
 	{
-		if (ParseAsciiStringToGameInfo(&info, header.gameOptions))
-		{
-			if (TheMapCache != nullptr)
-				mapData = TheMapCache->findMap(info.getMap());
-			else
-				mapData = nullptr;
-
-			return true;
-		}
+		return readReplayMapInfo(header, info, mapData);
 	}
 	return false;
 }
 
 //-------------------------------------------------------------------------------------------------
 
+// TheSuperHackers @performance Takes the header from the replay catalog instead of reading the replay file.
+static Bool readCatalogReplayMapInfo(const AsciiString& filename, RecorderClass::ReplayHeader &header, ReplayGameInfo &info, const MapMetaData *&mapData)
+{
+	if (TheReplayCatalog == nullptr)
+		return readReplayMapInfo(filename, header, info, mapData);
+
+	const ReplayCatalogEntry *entry = TheReplayCatalog->findReplay(filename);
+	if (entry == nullptr)
+		return false;
+
+	header = entry->m_header;
+	return readReplayMapInfo(header, info, mapData);
+}
+
+//-------------------------------------------------------------------------------------------------
+
 static void removeReplayExtension(UnicodeString& replayName)
 {
 	const Int extensionLength = TheRecorder->getReplayExtention().getLength();
@@ -275,6 +298,9 @@ void PopulateReplayFileListbox(GameWindow *listbox)
 
 	TheMapCache->updateCache();
 
+	if (TheReplayCatalog != nullptr)
+		TheReplayCatalog->updateCatalog();
+
 	for (it = replayFilenames.begin(); it != replayFilenames.end(); ++it)
 	{
 		// just want the filename
@@ -284,7 +310,7 @@ void PopulateReplayFileListbox(GameWindow *listbox)
 		ReplayGameInfo info;
 		const MapMetaData *mapData;
 
-		if (readReplayMapInfo(asciistr, header, info, mapData))
+		if (readCatalogReplayMapInfo(asciistr, header, info, mapData))
 		{
 			// columns are: name, date, version, map, extra
 
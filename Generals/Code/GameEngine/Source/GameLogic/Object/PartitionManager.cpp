@@ -54,6 +54,7 @@
 #include "Common/GameEngine.h"
 #include "Common/GameState.h"
 #include "Common/GameUtility.h"
+#include "Common/LogicProfiler.h"
 #include "Common/MessageStream.h"
 #include "Common/NameKeyGenerator.h"
 #include "Common/PerfTimer.h"
@@ -1014,6 +1015,11 @@ private:
 	PartitionContactListNode* m_contactHash[PartitionContactList_SOCKET_COUNT];
 	PartitionContactListNode* m_contactList;
 
+	// TheSuperHackers @performance The contact list only lives for one partition update. Its nodes are
+	// kept on a free list when it is reset and reused by the next update, instead of being returned to
+	// and taken from the memory pool every frame.
+	static PartitionContactListNode* s_freeNodes;
+
 public:
 
 	PartitionContactList()
@@ -1052,8 +1058,15 @@ public:
 	*/
 	void removeSpecificPartitionData(PartitionData* data);
 
+	/**
+		return the nodes kept for reuse to the memory pool.
+	*/
+	static void releaseFreeNodes();
+
 };
 
+PartitionContactListNode* PartitionContactList::s_freeNodes = nullptr;
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -1462,6 +1475,9 @@ void PartitionCell::friend_addToCellList(CellAndObjectIntersection *coi)
 	{
 		coi->friend_addToCellList(&m_firstCoiInCell);
 		++m_coiCount;
+#ifdef FASTER_GCO
+		ThePartitionManager->friend_notifyCellContentsChanged();
+#endif
 	}
 }
 
@@ -1472,6 +1488,9 @@ void PartitionCell::friend_removeFromCellList(CellAndObjectIntersection *coi)
 	{
 		coi->friend_removeFromCellList(&m_firstCoiInCell);
 		--m_coiCount;
+#ifdef FASTER_GCO
+		ThePartitionManager->friend_notifyCellContentsChanged();
+#endif
 	}
 }
 
@@ -2447,7 +2466,11 @@ void PartitionContactList::addToContactList( PartitionData *obj, PartitionData *
 	}
 
 	// new hit
-	PartitionContactListNode *ncd = newInstance(PartitionContactListNode);
+	PartitionContactListNode *ncd = s_freeNodes;
+	if (ncd)
+		s_freeNodes = ncd->m_next;
+	else
+		ncd = newInstance(PartitionContactListNode);
 	ncd->m_obj = obj;
 	ncd->m_other = other;
 	ncd->m_hashValue = hashValue;
@@ -2530,13 +2553,25 @@ void PartitionContactList::resetContactList()
 	for (PartitionContactListNode* cd = m_contactList; cd; cd = cdnext)
 	{
 		cdnext = cd->m_next;
-		deleteInstance(cd);
+		cd->m_next = s_freeNodes;
+		s_freeNodes = cd;
 	}
 
 	memset(m_contactHash, 0, sizeof(m_contactHash));
 	m_contactList = nullptr;
 }
 
+//-----------------------------------------------------------------------------
+void PartitionContactList::releaseFreeNodes()
+{
+	while (s_freeNodes)
+	{
+		PartitionContactListNode* next = s_freeNodes->m_next;
+		deleteInstance(s_freeNodes);
+		s_freeNodes = next;
+	}
+}
+
 //-----------------------------------------------------------------------------
 void PartitionContactList::processContactList()
 {
@@ -2617,6 +2652,9 @@ PartitionManager::PartitionManager()
 	m_updatedSinceLastReset = false;
 #ifdef FASTER_GCO
 	m_maxGcoRadius = 0;
+	m_gcoCellCacheEpoch = 1;
+	m_gcoCellCachesDirty = false;
+	m_gcoIterFlag = 1;	// nonzero, thanks
 #endif
 }
 
@@ -2745,6 +2783,8 @@ void PartitionManager::shutdown()
 {
 	m_updatedSinceLastReset = false;
 	removeAllDirtyModules();
+	SimpleObjectIterator::releaseFreeClumps();
+	PartitionContactList::releaseFreeNodes();
 
 #ifdef RTS_DEBUG
 	// the above *should* remove all the touched cells (via unRegisterObject), but let's check:
@@ -2760,6 +2800,8 @@ void PartitionManager::shutdown()
 
 #ifdef FASTER_GCO
 	m_radiusVec.clear();
+	m_gcoCellCaches.clear();
+	m_gcoScratchObjects.clear();
 #endif
 
 	resetPendingUndoShroudRevealQueue();
@@ -2779,6 +2821,7 @@ void PartitionManager::shutdown()
 //DECLARE_PERF_TIMER(PartitionManager_update)
 void PartitionManager::update()
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "update");
 	//USE_PERF_TIMER(PartitionManager_update)
 	{
 #ifdef INTENSE_DEBUG
@@ -3264,6 +3307,86 @@ void PartitionManager::calcRadiusVec()
 }
 #endif
 
+#ifdef FASTER_GCO
+//-----------------------------------------------------------------------------
+// Appends the objects in the cells at the given radius around a cell, skipping the ones already marked with iterFlag.
+void PartitionManager::appendGcoObjects(Int cellCenterX, Int cellCenterY, Int curRadius, Int iterFlag, std::vector<Object*>& objects)
+{
+	const OffsetVec& offsets = m_radiusVec[curRadius];
+	for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
+	{
+		PartitionCell* thisCell = getCellAt(cellCenterX + it->x, cellCenterY + it->y);
+		if (thisCell == nullptr)
+			continue;
+
+		for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
+		{
+			PartitionData *thisMod = thisCoi->getModule();
+			Object *thisObj = thisMod->getObject();
+
+			if (thisObj == nullptr)
+				continue;
+
+			// since an object can exist in multiple COIs, we use this to avoid processing
+			// the same one more than once.
+			if (thisMod->friend_getDoneFlag() == iterFlag)
+				continue;
+			thisMod->friend_setDoneFlag(iterFlag);
+
+			objects.push_back(thisObj);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Returns the cached objects around a cell up to at least maxRadius, or null if there are none. If allowBuild
+// is set, missing or outdated lists are built, which costs the same as one walk over the cells.
+const PartitionManager::GcoCellCache* PartitionManager::findGcoCellCache(Int cellCenterX, Int cellCenterY, Int maxRadius, Bool allowBuild)
+{
+	// Larger lists cost a lot of memory and are rarely asked for twice.
+	const Int MAX_CACHED_GCO_RADIUS = 16;
+
+	if (cellCenterX < 0 || cellCenterY < 0 || cellCenterX >= m_cellCountX || cellCenterY >= m_cellCountY)
+		return nullptr;
+
+	if (m_gcoCellCachesDirty)
+	{
+		++m_gcoCellCacheEpoch;
+		m_gcoCellCachesDirty = false;
+	}
+
+	if (m_gcoCellCaches.empty())
+	{
+		if (!allowBuild)
+			return nullptr;
+
+		GcoCellCache emptyCache;
+		emptyCache.epoch = 0;
+		emptyCache.builtRadius = -1;
+		m_gcoCellCaches.resize(m_totalCellCount, emptyCache);
+	}
+
+	GcoCellCache& cache = m_gcoCellCaches[cellCenterY * m_cellCountX + cellCenterX];
+	if (cache.epoch == m_gcoCellCacheEpoch && cache.builtRadius >= maxRadius)
+		return &cache;
+
+	if (!allowBuild || maxRadius > MAX_CACHED_GCO_RADIUS)
+		return nullptr;
+
+	++m_gcoIterFlag;
+	cache.objects.clear();
+	cache.ringEnds.clear();
+	for (Int curRadius = 0; curRadius <= maxRadius; ++curRadius)
+	{
+		appendGcoObjects(cellCenterX, cellCenterY, curRadius, m_gcoIterFlag, cache.objects);
+		cache.ringEnds.push_back((Int)cache.objects.size());
+	}
+	cache.epoch = m_gcoCellCacheEpoch;
+	cache.builtRadius = maxRadius;
+	return &cache;
+}
+#endif
+
 //-----------------------------------------------------------------------------
 //DECLARE_PERF_TIMER(getClosestObjects)
 Object *PartitionManager::getClosestObjects(
@@ -3348,8 +3471,12 @@ Object *PartitionManager::getClosestObjects(
 
 	Bool foundAny = false;
 
-	static Int theIterFlag = 1;	// nonzero, thanks
-	++theIterFlag;
+	// TheSuperHackers @performance Visit the objects from the cell cache if it has them. Queries that collect all
+	// objects in range walk every radius anyway, so they fill the cache for the queries that follow from this cell.
+	// The objects are visited in the same order as by walking the cells.
+	const GcoCellCache* cache = findGcoCellCache(cellCenterX, cellCenterY, maxRadiusLimit, iterArg != nullptr);
+	if (cache == nullptr)
+		++m_gcoIterFlag;
 
 	/*
 		m_radiusVec[curRadius] contains a list of the cells (foo) that could
@@ -3357,61 +3484,64 @@ Object *PartitionManager::getClosestObjects(
 	*/
   for (Int curRadius = 0; curRadius <= maxRadiusLimit; ++curRadius)
   {
-    const OffsetVec& offsets = m_radiusVec[curRadius];
-		if (offsets.empty())
-			continue;
-    for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
+		Object* const* thisObjIt;
+		Object* const* thisObjEnd;
+		if (cache != nullptr)
 		{
-			PartitionCell* thisCell = getCellAt(cellCenterX + it->x, cellCenterY + it->y);
-			if (thisCell == nullptr)
+			const Int first = curRadius > 0 ? cache->ringEnds[curRadius - 1] : 0;
+			const Int last = cache->ringEnds[curRadius];
+			if (first == last)
 				continue;
+			thisObjIt = &cache->objects[first];
+			thisObjEnd = thisObjIt + (last - first);
+		}
+		else
+		{
+			m_gcoScratchObjects.clear();
+			appendGcoObjects(cellCenterX, cellCenterY, curRadius, m_gcoIterFlag, m_gcoScratchObjects);
+			if (m_gcoScratchObjects.empty())
+				continue;
+			thisObjIt = &m_gcoScratchObjects[0];
+			thisObjEnd = thisObjIt + m_gcoScratchObjects.size();
+		}
 
-			for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
-			{
-				PartitionData *thisMod = thisCoi->getModule();
-				Object *thisObj = thisMod->getObject();
+		for (; thisObjIt != thisObjEnd; ++thisObjIt)
+		{
+			Object *thisObj = *thisObjIt;
 
-				// never compare against ourself.
-				if (thisObj == obj || thisObj == nullptr)
-					continue;
+			// never compare against ourself.
+			if (thisObj == obj)
+				continue;
 
-				// since an object can exist in multiple COIs, we use this to avoid processing
-				// the same one more than once.
-				if (thisMod->friend_getDoneFlag() == theIterFlag)
-					continue;
-				thisMod->friend_setDoneFlag(theIterFlag);
+			Real thisDistSqr;
+			Coord3D distVec;
+			if (!(*distProc)(objPos, objToUse, thisObj->getPosition(), thisObj, thisDistSqr, distVec, closestDistSqr))
+				continue;
 
-				Real thisDistSqr;
-				Coord3D distVec;
-				if (!(*distProc)(objPos, objToUse, thisObj->getPosition(), thisObj, thisDistSqr, distVec, closestDistSqr))
-					continue;
+			if (!filtersAllow(filters, thisObj))
+				continue;
 
-				if (!filtersAllow(filters, thisObj))
-					continue;
+			// ok, this is within the range, and the filters allow it.
+			// add it to the iter, if we have one....
+			if (iterArg)
+			{
+				iterArg->insert(thisObj, thisDistSqr);
+			}
+			else
+			{
+				// hey, this is the new closest object! cool.
+				// (note that we can't break out now 'cuz we have to finish examining the
+				// rest of curRadius)
+				closestObj = thisObj;
+				closestDistSqr = thisDistSqr;
+				closestVec = distVec;
 
-				// ok, this is within the range, and the filters allow it.
-				// add it to the iter, if we have one....
-				if (iterArg)
-				{
-					iterArg->insert(thisObj, thisDistSqr);
-				}
-				else
+				if (!foundAny)
 				{
-					// hey, this is the new closest object! cool.
-					// (note that we can't break out now 'cuz we have to finish examining the
-					// rest of curRadius)
-					closestObj = thisObj;
-					closestDistSqr = thisDistSqr;
-					closestVec = distVec;
-
-					if (!foundAny)
-					{
-						// if not adding to iterArg, we want to stop once we have the closest object.
-						maxRadiusLimit = curRadius;
-					}
-					foundAny = true;
+					// if not adding to iterArg, we want to stop once we have the closest object.
+					maxRadiusLimit = curRadius;
 				}
-
+				foundAny = true;
 			}
 		}
   }
@@ -3526,6 +3656,7 @@ Object *PartitionManager::getClosestObject(
 	Coord3D *closestDistVec
 )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "getClosestObject");
 	return getClosestObjects(obj, nullptr, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
 }
 
@@ -3539,6 +3670,7 @@ Object *PartitionManager::getClosestObject(
 	Coord3D *closestDistVec
 )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "getClosestObject");
 	return getClosestObjects(nullptr, pos, maxDist, dc, filters, nullptr, closestDist, closestDistVec);
 }
 
@@ -3672,6 +3804,7 @@ SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
 	IterOrderType order
 )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "iterateObjectsInRange");
 	MemoryPoolObjectHolder iterHolder;
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
@@ -3692,6 +3825,7 @@ SimpleObjectIterator *PartitionManager::iterateObjectsInRange(
 	IterOrderType order
 )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "iterateObjectsInRange");
 	MemoryPoolObjectHolder iterHolder;
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
@@ -3711,6 +3845,7 @@ SimpleObjectIterator* PartitionManager::iteratePotentialCollisions(
 	Bool use2D
 )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "iteratePotentialCollisions");
 	Real maxDist = geom.getBoundingSphereRadius();
 	maxDist *= 1.1f;	// just a little slop
 
@@ -3753,6 +3888,7 @@ Bool PartitionManager::isColliding( const Object *a, const Object *b ) const
 //-----------------------------------------------------------------------------
 SimpleObjectIterator *PartitionManager::iterateAllObjects(PartitionFilter **filters)
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "iterateAllObjects");
 	MemoryPoolObjectHolder iterHolder;
 	SimpleObjectIterator *iter = newInstance(SimpleObjectIterator);
 	iterHolder.hold(iter);
@@ -3955,6 +4091,7 @@ Bool PartitionManager::findPositionAround( const Coord3D *center,
 																					 const FindPositionOptions *options,
 																					 Coord3D *result )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "findPositionAround");
 
 	// sanity
 	if( center == nullptr || result == nullptr || options == nullptr )
@@ -4803,6 +4940,7 @@ Real PartitionManager::getGroundOrStructureHeight(Real posx, Real posy)
 //-------------------------------------------------------------------------------------------------
 void PartitionManager::getMostValuableLocation( Int playerIndex, UnsignedInt whichPlayerTypes, ValueOrThreat valType, Coord3D *outLocation )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "getMostValuableLocation");
 	if (!outLocation)
 		return;
 
@@ -4861,6 +4999,7 @@ void PartitionManager::getMostValuableLocation( Int playerIndex, UnsignedInt whi
 void PartitionManager::getNearestGroupWithValue( Int playerIndex, UnsignedInt whichPlayerTypes, ValueOrThreat valType,
 															 const Coord3D *sourceLocation, Int valueRequired, Bool greaterThan, Coord3D *outLocation )
 {
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_PARTITION_MANAGER, "getNearestGroupWithValue");
 	if (!(sourceLocation && outLocation))
 		return;
 
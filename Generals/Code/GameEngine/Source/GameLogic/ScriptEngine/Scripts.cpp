@@ -904,7 +904,13 @@ m_nextScript(nullptr),
 m_condition(nullptr),
 m_action(nullptr),
 m_actionFalse(nullptr),
-m_curTime(0.0f)
+m_curTime(0.0f),
+m_conditionsCompiled(false),
+m_conditionsReadVariablesOnly(false),
+m_conditionsReadCounters(false),
+m_cachedConditionResult(false),
+m_cachedConditionVersion(0),
+m_cachedTimerVersion(0)
 {
 }
 
@@ -1058,6 +1064,7 @@ void Script::updateFrom(Script *pSrc)
 	deleteInstance(this->m_condition);
 	this->m_condition = pSrc->m_condition;
 	pSrc->m_condition = nullptr;
+	invalidateCompiledConditions();
 
 	deleteInstance(this->m_action);
 	this->m_action = pSrc->m_action;
@@ -1088,6 +1095,7 @@ void Script::deleteOrCondition(OrCondition *pCond)
 	}
 	pCur->setNextOrCondition(nullptr);
 	deleteInstance(pCur);
+	invalidateCompiledConditions();
 }
 
 
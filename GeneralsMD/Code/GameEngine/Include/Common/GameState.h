@@ -38,6 +38,7 @@
 
 // FORWARD REFERENCES /////////////////////////////////////////////////////////////////////////////
 class GameWindow;
+class SaveGameFile;
 class WindowLayout;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,7 +154,7 @@ public:
 	// subsystem interface
 	virtual void init() override;
 	virtual void reset() override;
-	virtual void update() override { }
+	virtual void update() override;
 
 	// save game methods
 	SaveCode saveGame( AsciiString filename,
@@ -162,6 +163,8 @@ public:
 										 SnapshotType which = SNAPSHOT_SAVELOAD  );  ///< save a game
 	SaveCode missionSave();																	 ///< do a in between mission save
 	SaveCode loadGame( AvailableGameInfo gameInfo );							 ///< load a save file
+	SaveCode saveGameToBuffer( std::vector<UnsignedByte> &buffer );			///< save the game into memory, without any user interface
+	SaveCode loadGameFromBuffer( const UnsignedByte *data, Int dataSize );	///< load a game saved into memory, the caller resets the engine first
 	SaveGameInfo *getSaveGameInfo() { return &m_gameInfo; }
 
 	// snapshot interaction
@@ -206,6 +209,8 @@ private:
 
 	void clearAvailableGames();		///< clear any available games resources we got in our list
 
+	void finishSaveGameWrite();		///< wait for the save file to be written and tell the user how it went
+
 	struct SnapshotBlock
 	{
 		Snapshot *snapshot;								///< the snapshot object that handles this block
@@ -226,6 +231,9 @@ private:
 
 	AvailableGameInfo *m_availableGames;		///< list of available games we can save over or load from
 
+	SaveGameFile *m_saveGameFile;						///< writes the save files in the background
+	AsciiString m_writingSaveGamePath;				///< path of the save file being written, empty when it was reported
+
 	Bool m_isInLoadGame; // Brutal hack to allow bone pos validation while loading games
 };
 
@@ -353,6 +353,15 @@ public:
 
 	std::vector<AsciiString> m_simulateReplays; ///< If not empty, simulate this list of replays and exit.
 	Int m_simulateReplayJobs; ///< Maximum number of processes to use for simulation, or SIMULATE_REPLAYS_SEQUENTIAL for sequential simulation
+	Bool m_simulateReplayPersistentJobs; ///< If true, the simulation processes are kept alive and simulate multiple replays each
+	Bool m_simulateReplayWorker; ///< If true, keep simulating replays that are passed through stdin after the ones passed on the command line
+	AsciiString m_logicProfileFile; ///< If not empty, profile the game logic of simulated replays and write the report to this path
+	Int m_replayCheckpointInterval; ///< If greater than 0, write a checkpoint of simulated replays every this many logic frames
+	Int m_replaySeekFrame; ///< If greater than 0, simulated replays continue from their last checkpoint at or before this frame
+	AsciiString m_desyncTraceFile; ///< If not empty, write a desync trace of simulated replays to this path
+	Int m_desyncDumpFrame; ///< If not negative, dump the logic state at this frame next to the desync trace and stop the simulation
+	Bool m_buildReplayCatalog; ///< If true, rebuild the replay catalog and exit
+	Bool m_testJobSystem; ///< If true, run the job system tests and exit
 
 	Int m_maxParticleCount;						///< maximum number of particles that can exist
 	Int m_maxFieldParticleCount;			///< maximum number of field-type particles that can exist (roughly)
@@ -426,6 +435,10 @@ public:
 	Bool m_showMoneyPerMinute;
 	Bool m_allowMoneyPerMinuteForPlayer;
 
+	// TheSuperHackers @performance Compress save game files, and reuse the compressed blocks that did not change since the last save
+	Bool m_compressSaveGames;
+	Bool m_incrementalSaveGames;
+
 	Real m_shakeSubtleIntensity;			///< Intensity for shaking a camera with SHAKE_SUBTLE
 	Real m_shakeNormalIntensity;			///< Intensity for shaking a camera with SHAKE_NORMAL
 	Real m_shakeStrongIntensity;			///< Intensity for shaking a camera with SHAKE_STRONG
@@ -28,6 +28,11 @@
 #include "GameNetwork/GameInfo.h"
 
 class File;
+class ReplayCheckpointWriter;
+class ReplayCommandReader;
+class Xfer;
+struct ReplayCommand;
+struct ReplayCommandArgument;
 
 /**
   * The ReplayGameInfo class holds information about the replay game and
@@ -84,6 +89,11 @@ public:
 #endif
 	Bool isPlaybackInProgress() const;
 
+	// TheSuperHackers @feature Replay checkpoints, see ReplayCheckpoints.h
+	Bool writeCheckpoint();														///< Writes the state of the current frame to the checkpoint file of the playback.
+	Bool seekPlayback(UnsignedInt frame);							///< Continues the playback from the last checkpoint at or before frame.
+	static AsciiString getCheckpointFilename(AsciiString replayFilename);	///< Returns the path of the checkpoint file of a replay.
+
 public:
 	void handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool fromPlayback);
 protected:
@@ -112,6 +122,7 @@ public:
 		Int localPlayerIndex;
 	};
 	Bool readReplayHeader( ReplayHeader& header );
+	static Bool readReplayHeaderFields( File *file, ReplayHeader& header );	///< Reads the header without the recorder, see ReplayCatalog.h
 
 	RecorderModeType getMode();												///< Returns the current operating mode.
 	Bool isPlaybackMode() const { return m_mode == RECORDERMODETYPE_PLAYBACK || m_mode == RECORDERMODETYPE_SIMULATION_PLAYBACK; }
@@ -143,12 +154,15 @@ protected:
 	void logGameStart(AsciiString options);
 	void logGameEnd();
 
-	AsciiString readAsciiString();										///< Read the next string from m_file using ascii characters.
-	UnicodeString readUnicodeString();								///< Read the next string from m_file using unicode characters.
-	void readNextFrame();															///< Read the next frame number to execute a command on.
-	void appendNextCommand();													///< Read the next GameMessage and append it to TheCommandList.
+	static AsciiString readAsciiString(File *file);		///< Read the next string from file using ascii characters.
+	static UnicodeString readUnicodeString(File *file);	///< Read the next string from file using unicode characters.
+	void readNextFrame();															///< Read the next command and the frame number to execute it on.
+	void appendNextCommand();													///< Create the GameMessage of the next command and append it to TheCommandList.
 	void writeArgument(GameMessageArgumentDataType type, const GameMessageArgumentType arg);
-	void readArgument(GameMessageArgumentDataType type, GameMessage *msg);
+	void appendArgument(const ReplayCommandArgument &argument, GameMessage *msg);
+	void initCRCInfo(const ReplayHeader& header);					///< Creates the queue of local CRCs for the playback.
+	void xferPlaybackState(Xfer *xfer);								///< Saves or loads the playback position for a replay checkpoint.
+	void closeCheckpointWriter();
 
 	struct CullBadCommandsResult
 	{
@@ -174,6 +188,11 @@ protected:
 	Int m_originalGameMode; // valid in replays
 
 	UnsignedInt m_nextFrame;												///< The Frame that the next message is to be executed on.  This can be -1.
+	ReplayCommandReader *m_commandReader;								///< decodes the commands of the played back replay ahead
+	const ReplayCommand *m_nextCommand;									///< the command that is executed on m_nextFrame, owned by m_commandReader
+
+	ReplayCheckpointWriter *m_checkpointWriter;					///< valid while checkpoints are written during playback
+	UnsignedInt m_playbackKey;												///< identifies the played back replay in its checkpoint file
 };
 
 extern RecorderClass *TheRecorder;
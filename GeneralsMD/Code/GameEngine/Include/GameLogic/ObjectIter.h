@@ -116,6 +116,11 @@ private:
 	Clump				*m_curClump;
 	Int					m_clumpCount;
 
+	// TheSuperHackers @performance Iterators are created and emptied many times per logic frame.
+	// The clumps of emptied iterators are kept on a free list and reused by the next insertions,
+	// instead of being returned to and taken from the memory pool for every object.
+	static Clump *s_freeClumps;
+
 	void reset();
 
 public:
@@ -151,4 +156,9 @@ public:
 		return the total number of objects in the iterator.
 	*/
 	Int getCount() { return m_clumpCount; }
+
+	/**
+		return the clumps kept for reuse to the memory pool.
+	*/
+	static void releaseFreeClumps();
 };
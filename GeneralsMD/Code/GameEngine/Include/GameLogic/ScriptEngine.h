@@ -392,6 +392,9 @@ protected:
 	Bool evaluateFlag( Condition *pCondition );
 	Bool evaluateTimer( Condition *pCondition );
 	Bool evaluateCondition( Condition *pCondition );
+	void compileConditions( Script *pScript );
+	Bool conditionsReadCountdownTimers( Script *pScript );
+	void noteScriptVariablesChanged() { ++m_scriptVariableVersion; }
 	void executeActions( ScriptAction *pActionHead );
 
 	void setPriorityThing( ScriptAction *pAction );
@@ -406,6 +409,11 @@ protected:
 
 	AttackPriorityInfo *findAttackInfo(const AsciiString& name, Bool addIfNotFound);
 
+	// TheSuperHackers @performance Named object lookups go through a hash index into m_namedObjects.
+	Int findNamedObjectIndex(const AsciiString& name) const;
+	void appendNamedObject(const AsciiString& name, Object *obj);
+	void rebuildNamedObjectIndex();
+
 protected:
 	/// Stuff to execute scripts sequentially
 	typedef std::vector<SequentialScript*> VecSequentialScriptPtr;
@@ -438,6 +446,8 @@ protected:
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+	typedef std::hash_map< AsciiString, Int, rts::hash<AsciiString>, rts::equal_to<AsciiString> > NamedObjectIndexMap;
+	NamedObjectIndexMap m_namedObjectIndex;		///< Name to index of its first entry in m_namedObjects
 	Bool							m_firstUpdate;
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
@@ -453,6 +463,12 @@ protected:
 	Int								m_fadeFramesDecrease;
 
 	UnsignedInt				m_frameObjectCountChanged;
+	UnsignedInt				m_scriptVariableVersion;	///< Bumped whenever a counter, flag, timer or UI interaction changes, except for the ticks of countdown timers.
+	UnsignedInt				m_countdownTimerVersion;	///< Bumped on every frame that a countdown timer ticks.
+#ifdef DEBUG_LOGGING
+	Int								m_conditionCacheHits;			///< Scripts whose cached condition result was used since the last reset.
+	Int								m_conditionCacheMisses;		///< Cacheable scripts that had to be evaluated since the last reset.
+#endif
 
 	ObjectTypeCount		m_objectCounts[MAX_PLAYER_COUNT];
 
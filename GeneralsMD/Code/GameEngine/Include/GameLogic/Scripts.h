@@ -632,6 +632,12 @@ protected:	// Note - If you add any member vars, you must take them into account
 	Real				m_conditionTime;		///< Amount of time (cum) to evaluate conditions.
 	Real				m_curTime;		///< Amount of time (cum) to evaluate conditions.
 	Int					m_conditionExecutedCount; ///< Number of times conditions evaluated.
+	Bool				m_conditionsCompiled; ///< Runtime flag, true once m_conditionsReadVariablesOnly is valid.
+	Bool				m_conditionsReadVariablesOnly; ///< Runtime flag, true if the conditions only read script counters, flags and timers.
+	Bool				m_conditionsReadCounters; ///< Runtime flag, true if the conditions read counters, which may be countdown timers.
+	Bool				m_cachedConditionResult; ///< Last condition result, valid while m_cachedConditionVersion is current.
+	UnsignedInt m_cachedConditionVersion; ///< Script variable version the cached result belongs to. 0 means none.
+	UnsignedInt m_cachedTimerVersion; ///< Countdown timer version the cached result belongs to. 0 if it reads no running timer.
 
 public:
 	Script();
@@ -653,7 +659,7 @@ public:
 	void setHard(Bool hard) { m_hard = hard;}
 	void setSubroutine(Bool subr) { m_isSubroutine = subr;}
 	void setNextScript(Script *pScr) {m_nextScript = pScr;}
-	void setOrCondition(OrCondition *pCond) {m_condition = pCond;}
+	void setOrCondition(OrCondition *pCond) {m_condition = pCond; invalidateCompiledConditions();}
 	void setAction(ScriptAction *pAction) {m_action = pAction;}
 	void setFalseAction(ScriptAction *pAction) {m_actionFalse = pAction;}
 	void updateFrom(Script *pSrc); ///< Updates this from pSrc.  pSrc IS MODIFIED - it's guts are removed.  jba.
@@ -662,12 +668,20 @@ public:
 	void addToConditionTime(Real time) {m_conditionTime += time;}
 	void setCurTime(Real time) {m_curTime	= time;}
 	void setDelayEvalSeconds(Int delay) {m_delayEvaluationSeconds = delay;}
+	void setCompiledConditions(Bool readVariablesOnly, Bool readCounters) {m_conditionsCompiled = true; m_conditionsReadVariablesOnly = readVariablesOnly; m_conditionsReadCounters = readCounters; m_cachedConditionVersion = 0;}
+	void invalidateCompiledConditions() {m_conditionsCompiled = false; m_cachedConditionVersion = 0;}
+	void setCachedConditionResult(Bool result, UnsignedInt version, UnsignedInt timerVersion) {m_cachedConditionResult = result; m_cachedConditionVersion = version; m_cachedTimerVersion = timerVersion;}
 
 	UnsignedInt getFrameToEvaluate() {return m_frameToEvaluateAt;}
 	Int getConditionCount() {return m_conditionExecutedCount;}
 	Real getConditionTime() {return m_conditionTime;}
 	Real getCurTime() {return m_curTime;}
 	Int getDelayEvalSeconds() {return m_delayEvaluationSeconds;}
+	Bool hasCompiledConditions() const {return m_conditionsCompiled;}
+	Bool conditionsReadVariablesOnly() const {return m_conditionsReadVariablesOnly;}
+	Bool conditionsReadCounters() const {return m_conditionsReadCounters;}
+	Bool hasCachedConditionResult(UnsignedInt version, UnsignedInt timerVersion) const {return m_cachedConditionVersion == version && (m_cachedTimerVersion == 0 || m_cachedTimerVersion == timerVersion);}
+	Bool getCachedConditionResult() const {return m_cachedConditionResult;}
 
 	AsciiString getName() const { return m_scriptName;}
 	AsciiString getComment() const {return m_comment;}
@@ -963,6 +963,9 @@ GlobalData::GlobalData()
 	m_showMoneyPerMinute = FALSE;
 	m_allowMoneyPerMinuteForPlayer = FALSE;
 
+	m_compressSaveGames = TRUE;
+	m_incrementalSaveGames = FALSE;
+
 	m_debugShowGraphicalFramerate = FALSE;
 
 	// By default, show all asserts.
@@ -993,6 +996,15 @@ GlobalData::GlobalData()
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplayPersistentJobs = FALSE;
+	m_simulateReplayWorker = FALSE;
+	m_logicProfileFile.clear();
+	m_replayCheckpointInterval = 0;
+	m_replaySeekFrame = 0;
+	m_desyncTraceFile.clear();
+	m_desyncDumpFrame = -1;
+	m_buildReplayCatalog = FALSE;
+	m_testJobSystem = FALSE;
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
@@ -1216,6 +1228,9 @@ void GlobalData::parseGameDataDefinition( INI* ini )
 	TheWritableGlobalData->m_playerInfoListFontSize = optionPref.getPlayerInfoListFontSize();
 	TheWritableGlobalData->m_showMoneyPerMinute = optionPref.getShowMoneyPerMinute();
 
+	TheWritableGlobalData->m_compressSaveGames = optionPref.getCompressSaveGames();
+	TheWritableGlobalData->m_incrementalSaveGames = optionPref.getIncrementalSaveGames();
+
 	TheWritableGlobalData->m_antiAliasLevel = optionPref.getAntiAliasing();
 	TheWritableGlobalData->m_textureFilteringMode = optionPref.getTextureFilterMode();
 	TheWritableGlobalData->m_textureAnisotropyLevel = optionPref.getTextureAnisotropyLevel();
@@ -31,6 +31,11 @@
 #include "Common/Player.h"
 #include "Common/GlobalData.h"
 #include "Common/GameEngine.h"
+#include "Common/GameState.h"
+#include "Common/ReplayCheckpoints.h"
+#include "Common/ReplayCommandReader.h"
+#include "Common/XferLoadBuffer.h"
+#include "Common/XferSaveBuffer.h"
 #include "GameClient/ClientInstance.h"
 #include "GameClient/GameWindow.h"
 #include "GameClient/GameWindowManager.h"
@@ -45,6 +50,7 @@
 #include "GameLogic/GameLogic.h"
 #include "Common/RandomValue.h"
 #include "Common/CRCDebug.h"
+#include "Common/crc.h"
 #include "Common/OptionPreferences.h"
 #include "Common/version.h"
 
@@ -54,6 +60,7 @@ constexpr const UnsignedInt replayBufferBytes = 8192;
 Int REPLAY_CRC_INTERVAL = 100;
 
 const char *replayExtention = ".rep";
+const char *replayCheckpointExtension = ".rck";
 const char *lastReplayFileName = "00000000";	// a name the user is unlikely to ever type, but won't cause panic & confusion
 
 // TheSuperHackers @tweak helmutbuhler 25/04/2025
@@ -302,6 +309,11 @@ RecorderClass::RecorderClass()
 	m_archiveReplays = FALSE;
 	m_nextFrame = 0;
 	m_wasDesync = FALSE;
+	m_crcInfo = nullptr;
+	m_checkpointWriter = nullptr;
+	m_commandReader = NEW ReplayCommandReader;
+	m_nextCommand = nullptr;
+	m_playbackKey = 0;
 	init(); // just for the heck of it.
 }
 
@@ -309,6 +321,8 @@ RecorderClass::RecorderClass()
  * Destructor
  */
 RecorderClass::~RecorderClass() {
+	closeCheckpointWriter();
+	delete m_commandReader;
 }
 
 /**
@@ -343,11 +357,14 @@ void RecorderClass::init() {
  * Reset the recorder to the "initialized state."
  */
 void RecorderClass::reset() {
+	m_commandReader->close();
+	m_nextCommand = nullptr;
 	if (m_file != nullptr) {
 		m_file->close();
 		m_file = nullptr;
 	}
 	m_fileName.clear();
+	closeCheckpointWriter();
 
 	init();
 }
@@ -400,11 +417,14 @@ void RecorderClass::updatePlayback() {
  * reaching the end of the playback file.
  */
 void RecorderClass::stopPlayback() {
+	m_commandReader->close();
+	m_nextCommand = nullptr;
 	if (m_file != nullptr) {
 		m_file->close();
 		m_file = nullptr;
 	}
 	m_fileName.clear();
+	closeCheckpointWriter();
 
 	if (!m_doingAnalysis)
 	{
@@ -803,65 +823,84 @@ void RecorderClass::writeArgument(GameMessageArgumentDataType type, const GameMe
 }
 
 /**
- * Read in a replay header, for (1) populating a replay listbox or (2) starting playback.  In
- * case (2), set FILE *m_file.
+ * Read the header fields of a replay file up to the local player index, without checking the
+ * game options. Does not use the recorder, so headers of different files can be read in parallel.
  */
-Bool RecorderClass::readReplayHeader(ReplayHeader& header)
+Bool RecorderClass::readReplayHeaderFields(File *file, ReplayHeader& header)
 {
-	AsciiString filepath = getReplayDir();
-	filepath.concat(header.filename.str());
-
-	// TheSuperHackers @performance More buffered data reduces disk overhead and will improve fast forward playback
-	const UnsignedInt buffersize = header.forPlayback ? replayBufferBytes : File::BUFFERSIZE;
-	m_file = TheFileSystem->openFile(filepath.str(), File::READ | File::BINARY, buffersize);
-
-	if (m_file == nullptr)
-	{
-		DEBUG_LOG(("Can't open %s (%s)", filepath.str(), header.filename.str()));
-		return FALSE;
-	}
-
 	// Read the GENREP header.
 	char genrep[sizeof(s_genrep) - 1] = {0};
-	m_file->read( &genrep, sizeof(s_genrep) - 1 );
+	file->read( &genrep, sizeof(s_genrep) - 1 );
 	if ( strncmp(genrep, s_genrep, sizeof(s_genrep) - 1 ) != 0 ) {
-		DEBUG_LOG(("RecorderClass::readReplayHeader - replay file did not have GENREP at the start."));
-		m_file->close();
-		m_file = nullptr;
+		DEBUG_LOG(("RecorderClass::readReplayHeaderFields - replay file did not have GENREP at the start."));
 		return FALSE;
 	}
 
 	// read in some stats
 	replay_time_t tmp;
-	m_file->read(&tmp, sizeof(tmp));
+	file->read(&tmp, sizeof(tmp));
 	header.startTime = tmp;
-	m_file->read(&tmp, sizeof(tmp));
+	file->read(&tmp, sizeof(tmp));
 	header.endTime = tmp;
 
-	m_file->read(&header.frameCount, sizeof(header.frameCount));
+	file->read(&header.frameCount, sizeof(header.frameCount));
 
-	m_file->read(&header.desyncGame, sizeof(header.desyncGame));
-	m_file->read(&header.quitEarly, sizeof(header.quitEarly));
+	file->read(&header.desyncGame, sizeof(header.desyncGame));
+	file->read(&header.quitEarly, sizeof(header.quitEarly));
 	for (Int i=0; i<MAX_SLOTS; ++i)
 	{
-		m_file->read(&(header.playerDiscons[i]), sizeof(Bool));
+		file->read(&(header.playerDiscons[i]), sizeof(Bool));
 	}
 
 	// Read the Replay Name.  We don't actually do anything with it.  Oh well.
-	header.replayName = readUnicodeString();
+	header.replayName = readUnicodeString(file);
 
 	// Read the date and time.  We don't really do anything with this either. Oh well.
-	m_file->read(&header.timeVal, sizeof(header.timeVal));
+	file->read(&header.timeVal, sizeof(header.timeVal));
 
 	// Read in the Version info
-	header.versionString = readUnicodeString();
-	header.versionTimeString = readUnicodeString();
-	m_file->read(&header.versionNumber, sizeof(header.versionNumber));
-	m_file->read(&header.exeCRC, sizeof(header.exeCRC));
-	m_file->read(&header.iniCRC, sizeof(header.iniCRC));
+	header.versionString = readUnicodeString(file);
+	header.versionTimeString = readUnicodeString(file);
+	file->read(&header.versionNumber, sizeof(header.versionNumber));
+	file->read(&header.exeCRC, sizeof(header.exeCRC));
+	file->read(&header.iniCRC, sizeof(header.iniCRC));
+
+	// Read in the GameInfo
+	header.gameOptions = readAsciiString(file);
+
+	AsciiString playerIndex = readAsciiString(file);
+	header.localPlayerIndex = atoi(playerIndex.str());
+
+	return TRUE;
+}
+
+/**
+ * Read in a replay header, for (1) populating a replay listbox or (2) starting playback.  In
+ * case (2), set FILE *m_file.
+ */
+Bool RecorderClass::readReplayHeader(ReplayHeader& header)
+{
+	AsciiString filepath = getReplayDir();
+	filepath.concat(header.filename.str());
+
+	// TheSuperHackers @performance More buffered data reduces disk overhead and will improve fast forward playback
+	const UnsignedInt buffersize = header.forPlayback ? replayBufferBytes : File::BUFFERSIZE;
+	m_file = TheFileSystem->openFile(filepath.str(), File::READ | File::BINARY, buffersize);
+
+	if (m_file == nullptr)
+	{
+		DEBUG_LOG(("Can't open %s (%s)", filepath.str(), header.filename.str()));
+		return FALSE;
+	}
+
+	if (!readReplayHeaderFields(m_file, header))
+	{
+		m_file->close();
+		m_file = nullptr;
+		return FALSE;
+	}
 
 	// Read in the GameInfo
-	header.gameOptions = readAsciiString();
 	m_gameInfo.reset();
 	m_gameInfo.enterGame();
 	DEBUG_LOG(("RecorderClass::readReplayHeader - GameInfo = %s", header.gameOptions.str()));
@@ -874,8 +913,6 @@ Bool RecorderClass::readReplayHeader(ReplayHeader& header)
 	}
 	m_gameInfo.startGame(0);
 
-	AsciiString playerIndex = readAsciiString();
-	header.localPlayerIndex = atoi(playerIndex.str());
 	if (header.localPlayerIndex < -1 || header.localPlayerIndex >= MAX_SLOTS)
 	{
 		DEBUG_LOG(("RecorderClass::readReplayHeader - invalid local slot number."));
@@ -964,6 +1001,8 @@ public:
 	void setSawCRCMismatch() { m_sawCRCMismatch = TRUE; }
 	Bool sawCRCMismatch() const { return m_sawCRCMismatch; }
 
+	void xfer(Xfer *xfer);
+
 protected:
 
 	Bool m_sawCRCMismatch;
@@ -1010,6 +1049,33 @@ UnsignedInt CRCInfo::readCRC()
 	return val;
 }
 
+void CRCInfo::xfer(Xfer *xfer)
+{
+	xfer->xferBool(&m_sawCRCMismatch);
+	xfer->xferBool(&m_skippedOne);
+
+	UnsignedInt count = (UnsignedInt)m_data.size();
+	xfer->xferUnsignedInt(&count);
+	if (xfer->getXferMode() == XFER_SAVE)
+	{
+		for (std::list<UnsignedInt>::iterator it = m_data.begin(); it != m_data.end(); ++it)
+		{
+			UnsignedInt val = *it;
+			xfer->xferUnsignedInt(&val);
+		}
+	}
+	else
+	{
+		m_data.clear();
+		for (UnsignedInt i = 0; i < count; ++i)
+		{
+			UnsignedInt val = 0;
+			xfer->xferUnsignedInt(&val);
+			m_data.push_back(val);
+		}
+	}
+}
+
 Bool RecorderClass::sawCRCMismatch() const
 {
 	return m_crcInfo->sawCRCMismatch();
@@ -1111,6 +1177,31 @@ Bool RecorderClass::replayMatchesGameVersion(const ReplayHeader& header)
 	return true;
 }
 
+/**
+ * Identifies a replay for its checkpoint file. Replays recorded to the same file name
+ * differ at least in their start time.
+ */
+static UnsignedInt getReplayKey(const RecorderClass::ReplayHeader& header)
+{
+	CRC crc;
+	const Int64 startTime = header.startTime;
+	const Int64 endTime = header.endTime;
+	crc.computeCRC(&startTime, sizeof(startTime));
+	crc.computeCRC(&endTime, sizeof(endTime));
+	crc.computeCRC(&header.frameCount, sizeof(header.frameCount));
+	crc.computeCRC(header.gameOptions.str(), header.gameOptions.getLength());
+	return crc.get();
+}
+
+void RecorderClass::initCRCInfo(const ReplayHeader& header)
+{
+	Bool isMultiplayer = m_gameInfo.getSlot(header.localPlayerIndex)->getIP() != 0;
+	delete m_crcInfo;
+	m_crcInfo = NEW CRCInfo(header.localPlayerIndex, isMultiplayer);
+	REPLAY_CRC_INTERVAL = m_gameInfo.getCRCInterval();
+	DEBUG_LOG(("Player index is %d, replay CRC interval is %d", m_crcInfo->getLocalPlayer(), REPLAY_CRC_INTERVAL));
+}
+
 /**
  * Start playback of the file. Return true or false depending on if the file is
  * a valid replay file or not.
@@ -1194,10 +1285,8 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 	}
 #endif
 
-	Bool isMultiplayer = m_gameInfo.getSlot(header.localPlayerIndex)->getIP() != 0;
-	m_crcInfo = NEW CRCInfo(header.localPlayerIndex, isMultiplayer);
-	REPLAY_CRC_INTERVAL = m_gameInfo.getCRCInterval();
-	DEBUG_LOG(("Player index is %d, replay CRC interval is %d", m_crcInfo->getLocalPlayer(), REPLAY_CRC_INTERVAL));
+	initCRCInfo(header);
+	m_playbackKey = getReplayKey(header);
 
 	Int difficulty = 0;
 	m_file->read(&difficulty, sizeof(difficulty));
@@ -1217,6 +1306,9 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 	// Otherwise a crc message remains and messes up the crc calculation on the restarted replay.
 	TheCommandList->reset();
 
+	// TheSuperHackers @performance The commands are decoded in chunks, and ahead on a background thread
+	// when simulating headless, instead of being read field by field when they are due.
+	m_commandReader->open(m_file, TheGlobalData->m_headless);
 	readNextFrame();
 
 	// send a message to the logic for a new game
@@ -1242,13 +1334,176 @@ Bool RecorderClass::playbackFile(AsciiString filename)
 }
 
 /**
- * Read a unicode string from the current file position. The string is assumed to be 0-terminated.
+ * Write the state of the current frame to the checkpoint file of the playback. Call this between
+ * two logic frames. The checkpoint file is created with the first checkpoint and finished when the
+ * playback stops.
  */
-UnicodeString RecorderClass::readUnicodeString() {
+Bool RecorderClass::writeCheckpoint()
+{
+	if (!isPlaybackInProgress() || m_doingAnalysis)
+		return FALSE;
+
+	if (m_checkpointWriter == nullptr)
+	{
+		m_checkpointWriter = NEW ReplayCheckpointWriter;
+		if (!m_checkpointWriter->open(getCheckpointFilename(m_currentReplayFilename), m_playbackKey))
+		{
+			closeCheckpointWriter();
+			return FALSE;
+		}
+	}
+
+	ReplayCheckpoint checkpoint;
+	checkpoint.frame = TheGameLogic->getFrame();
+	checkpoint.logicCRC = TheGameLogic->getCRC(CRC_RECALC);
+	if (TheGameState->saveGameToBuffer(checkpoint.gameState) != SC_OK)
+		return FALSE;
+
+	XferSaveBuffer xferSave;
+	xferSave.open("ReplayPlaybackState");
+	xferPlaybackState(&xferSave);
+	xferSave.close();
+	checkpoint.playbackState.swap(xferSave.getBuffer());
+
+	return m_checkpointWriter->write(checkpoint);
+}
+
+/**
+ * Continue the playback from the last checkpoint at or before frame. The restored game state must
+ * have the CRC it had when the checkpoint was written, otherwise the playback restarts from the
+ * beginning of the replay. Returns true if the checkpoint was restored.
+ */
+Bool RecorderClass::seekPlayback(UnsignedInt frame)
+{
+	if (!isPlaybackMode() || m_doingAnalysis)
+		return FALSE;
+
+	const AsciiString filename = m_currentReplayFilename;
+	const RecorderModeType mode = m_mode;
+
+	ReplayCheckpoint checkpoint;
+	{
+		ReplayCheckpointReader reader;
+		if (!reader.open(getCheckpointFilename(filename), m_playbackKey) || !reader.read(frame, checkpoint))
+			return FALSE;
+	}
+
+	// Simulating the frames in between is cheaper than restoring a checkpoint that is not ahead
+	const UnsignedInt currentFrame = TheGameLogic->getFrame();
+	if (TheGameLogic->isInGame() && checkpoint.frame <= currentFrame && currentFrame <= frame)
+		return FALSE;
+
+	// This also resets the recorder
+	TheGameEngine->reset();
+
+	// Reopen the replay like for a new playback, but start the game from the checkpoint
+	// instead of the new game message
+	if (!playbackFile(filename))
+		return FALSE;
+	m_mode = mode;
+	TheCommandList->reset();
+
+	Bool restored = !checkpoint.gameState.empty() && !checkpoint.playbackState.empty()
+		&& TheGameState->loadGameFromBuffer(&checkpoint.gameState[0], (Int)checkpoint.gameState.size()) == SC_OK;
+	if (restored)
+	{
+		// The game state load may use logic random values, so the playback state goes last
+		XferLoadBuffer xferLoad(&checkpoint.playbackState[0], (Int)checkpoint.playbackState.size());
+		try
+		{
+			xferLoad.open("ReplayPlaybackState");
+			xferPlaybackState(&xferLoad);
+			xferLoad.close();
+		}
+		catch (...)
+		{
+			restored = FALSE;
+		}
+	}
+
+	if (restored)
+	{
+		const UnsignedInt logicCRC = TheGameLogic->getCRC(CRC_RECALC);
+		if (logicCRC != checkpoint.logicCRC)
+		{
+			DEBUG_LOG(("RecorderClass::seekPlayback - Checkpoint of frame %u restored with CRC %8.8X instead of %8.8X",
+				checkpoint.frame, logicCRC, checkpoint.logicCRC));
+			restored = FALSE;
+		}
+	}
+
+	if (!restored)
+	{
+		// Not all of the game state made it through the checkpoint, so start over
+		if (TheGameLogic->isInGame())
+			TheGameLogic->clearGameData(FALSE);
+		TheGameEngine->reset();
+		if (playbackFile(filename))
+			m_mode = mode;
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/**
+ * Returns the path of the checkpoint file that is written next to a replay file.
+ */
+AsciiString RecorderClass::getCheckpointFilename(AsciiString replayFilename)
+{
+	AsciiString filepath = getReplayDir();
+	filepath.concat(replayFilename);
+	if (filepath.endsWithNoCase(replayExtention))
+		filepath.truncateBy(strlen(replayExtention));
+	filepath.concat(replayCheckpointExtension);
+	return filepath;
+}
+
+void RecorderClass::xferPlaybackState(Xfer *xfer)
+{
+	XferVersion currentVersion = 1;
+	XferVersion version = currentVersion;
+	xfer->xferVersion(&version, currentVersion);
+
+	xfer->xferUnsignedInt(&m_nextFrame);
+
+	Int filePosition = m_nextCommand != nullptr ? m_nextCommand->position : 0;
+	xfer->xferInt(&filePosition);
+	if (xfer->getXferMode() == XFER_LOAD && filePosition > 0)
+	{
+		// The position is after the frame number of the next command, so decode that command again
+		m_commandReader->seek(filePosition - (Int)sizeof(m_nextFrame));
+		readNextFrame();
+	}
+
+	m_crcInfo->xfer(xfer);
+
+	// The logic random state is not part of save games
+	UnsignedInt randomState[6];
+	GetGameLogicRandomState(randomState);
+	xfer->xferUser(randomState, sizeof(randomState));
+	if (xfer->getXferMode() == XFER_LOAD)
+		SetGameLogicRandomState(randomState);
+}
+
+void RecorderClass::closeCheckpointWriter()
+{
+	if (m_checkpointWriter != nullptr)
+	{
+		m_checkpointWriter->close();
+		delete m_checkpointWriter;
+		m_checkpointWriter = nullptr;
+	}
+}
+
+/**
+ * Read a unicode string from the current position of file. The string is assumed to be 0-terminated.
+ */
+UnicodeString RecorderClass::readUnicodeString(File *file) {
 	WideChar str[1024] = L"";
 	Int index = 0;
 
-	Int c = m_file->readWideChar();
+	Int c = file->readWideChar();
 	if (c == EOF) {
 		str[index] = 0;
 	}
@@ -1256,7 +1511,7 @@ UnicodeString RecorderClass::readUnicodeString() {
 
 	while (index < 1024 && str[index] != 0) {
 		++index;
-		Int c = m_file->readWideChar();
+		Int c = file->readWideChar();
 		if (c == EOF) {
 			str[index] = 0;
 			break;
@@ -1270,13 +1525,13 @@ UnicodeString RecorderClass::readUnicodeString() {
 }
 
 /**
- * Read an ascii string from the current file position. The string is assumed to be 0-terminated.
+ * Read an ascii string from the current position of file. The string is assumed to be 0-terminated.
  */
-AsciiString RecorderClass::readAsciiString() {
+AsciiString RecorderClass::readAsciiString(File *file) {
 	char str[1024] = "";
 	Int index = 0;
 
-	Int c =	m_file->readChar();
+	Int c =	file->readChar();
 	if (c == EOF) {
 		str[index] = 0;
 	}
@@ -1284,7 +1539,7 @@ AsciiString RecorderClass::readAsciiString() {
 
 	while (index < 1024 && str[index] != 0) {
 		++index;
-		Int c = m_file->readChar();
+		Int c = file->readChar();
 		if (c == EOF) {
 			str[index] = 0;
 			break;
@@ -1302,25 +1557,28 @@ AsciiString RecorderClass::readAsciiString() {
  * is stopped and the next frame is said to be -1.
  */
 void RecorderClass::readNextFrame() {
-	Int bytesRead = m_file->read(&m_nextFrame, sizeof(m_nextFrame));
-	if (bytesRead != sizeof(m_nextFrame)) {
+	m_nextCommand = m_commandReader->next();
+	if (m_nextCommand == nullptr) {
 		DEBUG_LOG(("RecorderClass::readNextFrame - read failed on frame %d", TheGameLogic->getFrame()));
 		m_nextFrame = -1;
 		stopPlayback();
+		return;
 	}
+	m_nextFrame = m_nextCommand->frame;
 }
 
 /**
  * This reads the next command from the replay file and appends it to TheCommandList.
  */
 void RecorderClass::appendNextCommand() {
-	GameMessage::Type type;
-	Int bytesRead = m_file->read(&type, sizeof(type));
-	if (bytesRead != sizeof(type)) {
+	if (m_nextCommand == nullptr) {
 		DEBUG_LOG(("RecorderClass::appendNextCommand - read failed on frame %d", m_nextFrame/*TheGameLogic->getFrame()*/));
 		return;
 	}
 
+	const ReplayCommand *command = m_nextCommand;
+	GameMessage::Type type = (GameMessage::Type)command->type;
+
 	GameMessage *msg = newInstance(GameMessage)(type);
 
 #ifdef DEBUG_LOGGING
@@ -1335,9 +1593,7 @@ void RecorderClass::appendNextCommand() {
 	}
 #endif // DEBUG_LOGGING
 
-	Int playerIndex = -1;
-	m_file->read(&playerIndex, sizeof(playerIndex));
-	msg->friend_setPlayerIndex(playerIndex);
+	msg->friend_setPlayerIndex(command->playerIndex);
 
 	// don't debug log this if we're debugging sync errors, as it will cause diff problems between a game and it's replay...
 #ifdef DEBUG_LOGGING
@@ -1353,44 +1609,9 @@ void RecorderClass::appendNextCommand() {
 	}
 #endif
 
-	UnsignedByte numTypes = 0;
-	Int totalArgs = 0;
-	m_file->read(&numTypes, sizeof(numTypes));
-
-	GameMessageParser *parser = newInstance(GameMessageParser)();
-	for (UnsignedByte i = 0; i < numTypes; ++i) {
-		UnsignedByte type = (UnsignedByte)ARGUMENTDATATYPE_UNKNOWN;
-		m_file->read(&type, sizeof(type));
-		UnsignedByte numArgs = 0;
-		m_file->read(&numArgs, sizeof(numArgs));
-		parser->addArgType((GameMessageArgumentDataType)type, numArgs);
-		totalArgs += numArgs;
-	}
-
-	GameMessageParserArgumentType *parserArgType = parser->getFirstArgumentType();
-	GameMessageArgumentDataType lasttype = ARGUMENTDATATYPE_UNKNOWN;
-	Int argsLeftForType = 0;
-	if (parserArgType != nullptr) {
-		lasttype = parserArgType->getType();
-		argsLeftForType = parserArgType->getArgCount();
-	}
-	for (Int j = 0; j < totalArgs; ++j) {
-		readArgument(lasttype, msg);
-
-		--argsLeftForType;
-		if (argsLeftForType == 0) {
-			DEBUG_ASSERTCRASH(parserArgType != nullptr, ("parserArgType was null when it shouldn't have been."));
-			if (parserArgType == nullptr) {
-				return;
-			}
-
-			parserArgType = parserArgType->getNext();
-			// parserArgType is allowed to be null here, this is the case if there are no more arguments.
-			if (parserArgType != nullptr) {
-				argsLeftForType = parserArgType->getArgCount();
-				lasttype = parserArgType->getType();
-			}
-		}
+	const ReplayCommandArgument *arguments = m_commandReader->getArguments(command);
+	for (Int i = 0; i < command->argumentCount; ++i) {
+		appendArgument(arguments[i], msg);
 	}
 
 	if (type != GameMessage::MSG_BEGIN_NETWORK_MESSAGES && type != GameMessage::MSG_CLEAR_GAME_DATA && !m_doingAnalysis)
@@ -1402,16 +1623,12 @@ void RecorderClass::appendNextCommand() {
 		deleteInstance(msg);
 		msg = nullptr;
 	}
-
-	deleteInstance(parser);
-	parser = nullptr;
 }
 
-void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *msg) {
-	switch (type) {
+void RecorderClass::appendArgument(const ReplayCommandArgument &argument, GameMessage *msg) {
+	switch (argument.type) {
 		case ARGUMENTDATATYPE_INTEGER: {
-			Int theint;
-			m_file->read(&theint, sizeof(theint));
+			const Int theint = argument.value.integer;
 			msg->appendIntegerArgument(theint);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1422,8 +1639,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_REAL: {
-			Real thereal;
-			m_file->read(&thereal, sizeof(thereal));
+			const Real thereal = argument.value.real;
 			msg->appendRealArgument(thereal);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1434,8 +1650,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_BOOLEAN: {
-			Bool thebool;
-			m_file->read(&thebool, sizeof(thebool));
+			const Bool thebool = argument.value.boolean;
 			msg->appendBooleanArgument(thebool);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1446,8 +1661,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_OBJECTID: {
-			ObjectID theid;
-			m_file->read(&theid, sizeof(theid));
+			const ObjectID theid = argument.value.objectID;
 			msg->appendObjectIDArgument(theid);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1458,8 +1672,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_DRAWABLEID: {
-			DrawableID theid;
-			m_file->read(&theid, sizeof(theid));
+			const DrawableID theid = argument.value.drawableID;
 			msg->appendDrawableIDArgument(theid);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1470,8 +1683,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_TEAMID: {
-			UnsignedInt theid;
-			m_file->read(&theid, sizeof(theid));
+			const UnsignedInt theid = argument.value.teamID;
 			msg->appendTeamIDArgument(theid);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1482,8 +1694,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_LOCATION: {
-			Coord3D loc;
-			m_file->read(&loc, sizeof(loc));
+			const Coord3D &loc = argument.value.location;
 			msg->appendLocationArgument(loc);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1495,8 +1706,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_PIXEL: {
-			ICoord2D pixel;
-			m_file->read(&pixel, sizeof(pixel));
+			const ICoord2D &pixel = argument.value.pixel;
 			msg->appendPixelArgument(pixel);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1507,8 +1717,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_PIXELREGION: {
-			IRegion2D reg;
-			m_file->read(&reg, sizeof(reg));
+			const IRegion2D &reg = argument.value.pixelRegion;
 			msg->appendPixelRegionArgument(reg);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1519,8 +1728,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_TIMESTAMP: {  // Not to be confused with Terrance Stamp... Kneel before Zod!!!
-			UnsignedInt stamp;
-			m_file->read(&stamp, sizeof(stamp));
+			const UnsignedInt stamp = argument.value.timestamp;
 			msg->appendTimestampArgument(stamp);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
@@ -1531,8 +1739,7 @@ void RecorderClass::readArgument(GameMessageArgumentDataType type, GameMessage *
 			break;
 		}
 		case ARGUMENTDATATYPE_WIDECHAR: {
-			WideChar theid;
-			m_file->read(&theid, sizeof(theid));
+			const WideChar theid = argument.value.wChar;
 			msg->appendWideCharArgument(theid);
 #ifdef DEBUG_LOGGING
 			if (m_doingAnalysis)
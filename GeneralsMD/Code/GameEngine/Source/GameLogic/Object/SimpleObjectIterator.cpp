@@ -44,6 +44,8 @@ SimpleObjectIterator::ClumpCompareProc SimpleObjectIterator::theClumpCompareProc
 	SimpleObjectIterator::sortExpensiveToCheap
 };
 
+SimpleObjectIterator::Clump *SimpleObjectIterator::s_freeClumps = nullptr;
+
 //=============================================================================
 SimpleObjectIterator::Clump::Clump()
 {
@@ -74,7 +76,11 @@ void SimpleObjectIterator::insert(Object *obj, Real numeric)
 {
 	DEBUG_ASSERTCRASH(obj, ("sorry, no nulls allowed here"));
 
-	Clump *clump = newInstance(Clump)();
+	Clump *clump = s_freeClumps;
+	if (clump)
+		s_freeClumps = clump->m_nextClump;
+	else
+		clump = newInstance(Clump)();
 
 	clump->m_nextClump = m_firstClump;
 	m_firstClump = clump;
@@ -115,7 +121,9 @@ void SimpleObjectIterator::makeEmpty()
 	while (m_firstClump)
 	{
 		Clump *next = m_firstClump->m_nextClump;
-		deleteInstance(m_firstClump);
+		m_firstClump->m_obj = nullptr;
+		m_firstClump->m_nextClump = s_freeClumps;
+		s_freeClumps = m_firstClump;
 		m_firstClump = next;
 		--m_clumpCount;
 	}
@@ -126,6 +134,17 @@ void SimpleObjectIterator::makeEmpty()
 	m_clumpCount = 0;
 }
 
+//=============================================================================
+void SimpleObjectIterator::releaseFreeClumps()
+{
+	while (s_freeClumps)
+	{
+		Clump *next = s_freeClumps->m_nextClump;
+		deleteInstance(s_freeClumps);
+		s_freeClumps = next;
+	}
+}
+
 //=============================================================================
 void SimpleObjectIterator::sort(IterOrderType order)
 {
@@ -34,6 +34,7 @@
 #include "Common/FramePacer.h"
 #include "Common/GameState.h"
 #include "Common/LatchRestore.h"
+#include "Common/LogicProfiler.h"
 #include "Common/MessageStream.h"
 #include "Common/PerfTimer.h"
 #include "Common/Player.h"
@@ -445,6 +446,8 @@ m_skirmishHumanPlayer(nullptr),
 m_fade(FADE_NONE),
 m_freezeByScript(FALSE),
 m_frameObjectCountChanged(0),
+m_scriptVariableVersion(1),
+m_countdownTimerVersion(1),
 m_closeWindowTimer(0),
 m_curFadeFrame(0),
 m_curFadeValue(0.0f),
@@ -556,6 +559,11 @@ void ScriptEngine::init()
 #endif
 #endif
 
+#ifdef DEBUG_LOGGING
+	m_conditionCacheHits = 0;
+	m_conditionCacheMisses = 0;
+#endif
+
 	if (TheScriptActions) {
 		TheScriptActions->init();
 	}
@@ -5311,6 +5319,15 @@ void ScriptEngine::reset()
 	m_objectsShouldReceiveDifficultyBonus = TRUE;
 	m_ChooseVictimAlwaysUsesNormal = false;
 
+#ifdef DEBUG_LOGGING
+	if (m_conditionCacheHits + m_conditionCacheMisses > 0) {
+		DEBUG_LOG(("Script condition cache: %d hits, %d misses, %d%% hit rate", m_conditionCacheHits, m_conditionCacheMisses,
+			m_conditionCacheHits * 100 / (m_conditionCacheHits + m_conditionCacheMisses)));
+	}
+	m_conditionCacheHits = 0;
+	m_conditionCacheMisses = 0;
+#endif
+
 #ifdef SPECIAL_SCRIPT_PROFILING
 #ifdef DEBUG_LOGGING
 	if (m_numFrames > 1) {
@@ -5393,11 +5410,13 @@ void ScriptEngine::reset()
 
 	// Clear the named objects list.
  	m_namedObjects.clear();
+	m_namedObjectIndex.clear();
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
 	m_testingAudio.clear();
 	m_uiInteractions.clear();
+	noteScriptVariablesChanged();
 	for (i=0; i<MAX_PLAYER_COUNT; ++i)
 	{
 		m_triggeredSpecialPowers[i].clear();
@@ -5453,6 +5472,7 @@ void ScriptEngine::newMap()
 	m_testingSpeech.clear();
 	m_testingAudio.clear();
 	m_uiInteractions.clear();
+	noteScriptVariablesChanged();
 	for (i=0; i<MAX_PLAYER_COUNT; ++i)
 	{
 		m_triggeredSpecialPowers[i].clear();
@@ -5559,15 +5579,22 @@ void ScriptEngine::update()
 	}
 	// Update any countdown timers.
 	Int i;
+	Bool timerTicked = false;
 	// Note - counters start at 1.  0 means not assigned.
 	for (i=1; i<m_numCounters; i++) {
 		if (m_counters[i].isCountdownTimer) {
 			// If counter has any time left, decrement.  Counters go to -1 and stop.
 			if (m_counters[i].value >= 0) {
 				m_counters[i].value--;
+				timerTicked = true;
 			}
 		}
 	}
+	// TheSuperHackers @performance Ticking timers only invalidate the cached conditions of scripts
+	// that read a running timer.
+	if (timerTicked) {
+		++m_countdownTimerVersion;
+	}
 
 	// Evaluate the scripts.
 	for (i=0; i<TheSidesList->getNumSides(); i++) {
@@ -5593,7 +5620,10 @@ void ScriptEngine::update()
 	ThePlayerList->updateTeamStates();
 
 	// Clear the UI Interaction flags.
-	m_uiInteractions.clear();
+	if (!m_uiInteractions.empty()) {
+		m_uiInteractions.clear();
+		noteScriptVariablesChanged();
+	}
 
 	// update all sequential stuff.
 	evaluateAndProgressAllSequentialScripts();
@@ -5770,6 +5800,7 @@ void ScriptEngine::clearFlag(const AsciiString &name)
 		for (i=1; i<m_numFlags; i++) {
 			if ((modName==m_flags[i].name)) {
 				m_flags[i].value = FALSE;
+				noteScriptVariablesChanged();
 			}
 		}
 	}
@@ -5999,10 +6030,9 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 		return m_conditionObject;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return it->second;
-		}
+	Int index = findNamedObjectIndex(unitName);
+	if (index >= 0) {
+		return m_namedObjects[index].second;
 	}
 	return nullptr;
 }
@@ -6012,14 +6042,50 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::didUnitExist(const AsciiString& unitName)
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return (it->second == nullptr);
-		}
+	Int index = findNamedObjectIndex(unitName);
+	if (index >= 0) {
+		return (m_namedObjects[index].second == nullptr);
 	}
 	return false;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Returns the index of the first m_namedObjects entry with this name, or -1. */
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObjectIndex(const AsciiString& name) const
+{
+	NamedObjectIndexMap::const_iterator it = m_namedObjectIndex.find(name);
+	if (it == m_namedObjectIndex.end()) {
+		return -1;
+	}
+	return it->second;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Appends an entry to m_namedObjects. The index keeps pointing at the first entry of a name. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::appendNamedObject(const AsciiString& name, Object *obj)
+{
+	NamedRequest req;
+	req.first = name;
+	req.second = obj;
+	m_namedObjects.push_back(req);
+
+	Int index = (Int)m_namedObjects.size() - 1;
+	m_namedObjectIndex.insert(NamedObjectIndexMap::value_type(name, index));
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Rebuilds the name index after m_namedObjects was renamed in place. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::rebuildNamedObjectIndex()
+{
+	m_namedObjectIndex.clear();
+	for (Int i = 0; i < (Int)m_namedObjects.size(); ++i) {
+		m_namedObjectIndex.insert(NamedObjectIndexMap::value_type(m_namedObjects[i].first, i));
+	}
+}
+
 //-------------------------------------------------------------------------------------------------
 /** runScript - Executes a subroutine script, or script group - tests conditions, and executes actions or false actions.  */
 //-------------------------------------------------------------------------------------------------
@@ -6364,6 +6430,7 @@ void ScriptEngine::setCounter( ScriptAction *pAction )
 	}
 	Int value = pAction->getParameter(1)->getInt();
 	m_counters[counterNdx].value = value;
+	noteScriptVariablesChanged();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6432,6 +6499,7 @@ void ScriptEngine::addCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value += value;
+	noteScriptVariablesChanged();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6447,6 +6515,7 @@ void ScriptEngine::subCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value -= value;
+	noteScriptVariablesChanged();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6491,6 +6560,7 @@ void ScriptEngine::setFlag( ScriptAction *pAction )
 	}
 	Bool value = pAction->getParameter(1)->getInt();
 	m_flags[flagNdx].value = value;
+	noteScriptVariablesChanged();
 }
 
 
@@ -6753,6 +6823,7 @@ void ScriptEngine::setTimer( ScriptAction *pAction, Bool millisecondTimer, Bool
 		m_counters[counterNdx].value = value;
 	}
 	m_counters[counterNdx].isCountdownTimer = true;
+	noteScriptVariablesChanged();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6767,6 +6838,7 @@ void ScriptEngine::pauseTimer( ScriptAction *pAction )
 		pAction->getParameter(0)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].isCountdownTimer = false;
+	noteScriptVariablesChanged();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6782,6 +6854,7 @@ void ScriptEngine::restartTimer( ScriptAction *pAction )
 	}
 	if (m_counters[counterNdx].value > 0) {
 		m_counters[counterNdx].isCountdownTimer = true;
+		noteScriptVariablesChanged();
 	}
 }
 
@@ -6807,6 +6880,7 @@ void ScriptEngine::adjustTimer( ScriptAction *pAction, Bool millisecondTimer, Bo
 			value = -value;
 		m_counters[counterNdx].value += value;
 	}
+	noteScriptVariablesChanged();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7047,11 +7121,15 @@ void ScriptEngine::executeScript( Script *pScript )
 	m_conditionTeam = pSavConditionTeam;
 }
 
+// TheSuperHackers @info Define to evaluate cached script conditions anyway and crash if the cached result differs.
+//#define VERIFY_SCRIPT_CONDITION_CACHE
+
 //-------------------------------------------------------------------------------------------------
 /** Evaluates a condition */
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::evaluateCondition( Condition *pCondition )
 {
+	LOGIC_PROFILE_SECTION(CATEGORY_SCRIPT_CONDITION, pCondition->getConditionType());
 	switch (pCondition->getConditionType()) {
 		default:
 			return TheScriptConditions->evaluateCondition(pCondition);
@@ -7063,6 +7141,64 @@ Bool ScriptEngine::evaluateCondition( Condition *pCondition )
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Records whether a script's conditions depend on nothing but script counters, flags and timers.
+		The result of such a script only changes when m_scriptVariableVersion does, or when
+		m_countdownTimerVersion does if it reads a running countdown timer. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::compileConditions( Script *pScript )
+{
+	Bool readVariablesOnly = true;
+	Bool readCounters = false;
+	OrCondition *pOr;
+	for (pOr = pScript->getOrCondition(); pOr && readVariablesOnly; pOr = pOr->getNextOrCondition()) {
+		Condition *pCondition;
+		for (pCondition = pOr->getFirstAndCondition(); pCondition; pCondition = pCondition->getNext()) {
+			switch (pCondition->getConditionType()) {
+				case Condition::COUNTER:
+				case Condition::TIMER_EXPIRED:
+					readCounters = true;
+					continue;
+				case Condition::CONDITION_FALSE:
+				case Condition::CONDITION_TRUE:
+				case Condition::FLAG:
+					continue;
+				default:
+					readVariablesOnly = false;
+					break;
+			}
+			break;
+		}
+	}
+	pScript->setCompiledConditions(readVariablesOnly, readCounters);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Returns true if a counter condition of the script reads a countdown timer. Starting or stopping
+		a timer changes m_scriptVariableVersion, so the answer holds as long as that does not change. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::conditionsReadCountdownTimers( Script *pScript )
+{
+	if (!pScript->conditionsReadCounters()) {
+		return false;
+	}
+	OrCondition *pOr;
+	for (pOr = pScript->getOrCondition(); pOr; pOr = pOr->getNextOrCondition()) {
+		Condition *pCondition;
+		for (pCondition = pOr->getFirstAndCondition(); pCondition; pCondition = pCondition->getNext()) {
+			if (pCondition->getConditionType() != Condition::COUNTER && pCondition->getConditionType() != Condition::TIMER_EXPIRED) {
+				continue;
+			}
+			// Counters are looked up on their first evaluation, so an unknown one may be a timer.
+			Int counterNdx = pCondition->getParameter(0)->getInt();
+			if (counterNdx == 0 || m_counters[counterNdx].isCountdownTimer) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Execute an action specified by pActionHead */
 //-------------------------------------------------------------------------------------------------
@@ -7095,35 +7231,37 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		return;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (it->first == objName) {
-			if (it->second == nullptr) {
-				AsciiString newNameForDead;
-				newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
-				AppendDebugMessage(newNameForDead, FALSE);
-				DEBUG_LOG((newNameForDead.str()));
-				it->second = pNewObject;
-				return;
-			} else {
-				DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s',"
-										 " but object (%d) of type '%s' already has that name",
-										 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(),
-										 it->second->getID(), it->second->getTemplate()->getName().str()));
-				return;
-			}
+	// The first entry carrying either this name or this object wins. Only the entries before the
+	// first name match need to be searched for the object.
+	Int nameIndex = findNamedObjectIndex(objName);
+	Int searchEnd = (nameIndex >= 0) ? nameIndex : (Int)m_namedObjects.size();
+	for (Int i = 0; i < searchEnd; ++i) {
+		if (pNewObject == m_namedObjects[i].second) {
+			m_namedObjects[i].first = objName;
+			rebuildNamedObjectIndex();
+			return;
 		}
+	}
 
-		if (pNewObject == (it->second)) {
-			it->first = objName;
+	if (nameIndex >= 0) {
+		VecNamedRequestsIt it = m_namedObjects.begin() + nameIndex;
+		if (it->second == nullptr) {
+			AsciiString newNameForDead;
+			newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
+			AppendDebugMessage(newNameForDead, FALSE);
+			DEBUG_LOG((newNameForDead.str()));
+			it->second = pNewObject;
+			return;
+		} else {
+			DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s',"
+									 " but object (%d) of type '%s' already has that name",
+									 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(),
+									 it->second->getID(), it->second->getTemplate()->getName().str()));
 			return;
 		}
 	}
 
-	NamedRequest req;
-	req.first = objName;
-	req.second = pNewObject;
-
-	m_namedObjects.push_back(req);
+	appendNamedObject(objName, pNewObject);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7164,26 +7302,25 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 
 	pNewObject->setName(unitName); // make sure it has the correct name.
 
-	//Loop through the cached list and find the string entry. If found, change the object
+	//Find the string entry in the cached list. If found, change the object
 	//so it's pointing to the new one.
-	for( VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it )
+	Int index = findNamedObjectIndex( unitName );
+	if( index >= 0 )
 	{
-		if( !unitName.compare( it->first ) )
+		VecNamedRequestsIt it = m_namedObjects.begin() + index;
+		Object* pOldObj = it->second;
+		if( pOldObj )
 		{
-			Object* pOldObj = it->second;
-			if( pOldObj )
-			{
-				// if you are transferring your name, you should also transfer any custom indicator color you have.
-				if (pOldObj->hasCustomIndicatorColor())
-					pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
-				else
-					pNewObject->removeCustomIndicatorColor();
-			}
+			// if you are transferring your name, you should also transfer any custom indicator color you have.
+			if (pOldObj->hasCustomIndicatorColor())
+				pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
+			else
+				pNewObject->removeCustomIndicatorColor();
+		}
 
-			it->second = pNewObject;
+		it->second = pNewObject;
 
-			return;
-		}
+		return;
 	}
 
 }
@@ -7260,6 +7397,7 @@ void ScriptEngine::notifyOfAcquiredScience( Int playerIndex, ScienceType science
 void ScriptEngine::signalUIInteract(const AsciiString& hookName)
 {
 	m_uiInteractions.push_front(hookName);
+	noteScriptVariablesChanged();
 #ifdef DEBUG_LOGGING
 	AppendDebugMessage(hookName, false); // don't bother in Release
 #endif
@@ -7579,6 +7717,27 @@ Bool ScriptEngine::evaluateConditions( Script *pScript, Team *thisTeam, Player *
 	if (thisTeam) player = thisTeam->getControllingPlayer();
 	if (player==nullptr) player=m_currentPlayer;
 	LatchRestore<Player*> latch2(m_currentPlayer, player);
+
+	// TheSuperHackers @performance Scripts that only read counters, flags and timers reuse their
+	// last result until one of those changes. Ticking timers only count for scripts that read them.
+	if (!pScript->hasCompiledConditions()) {
+		compileConditions(pScript);
+	}
+	const Bool useCachedResult = pScript->conditionsReadVariablesOnly();
+	const Bool hasCachedResult = useCachedResult && pScript->hasCachedConditionResult(m_scriptVariableVersion, m_countdownTimerVersion);
+#ifdef DEBUG_LOGGING
+	if (hasCachedResult) {
+		++m_conditionCacheHits;
+	} else if (useCachedResult) {
+		++m_conditionCacheMisses;
+	}
+#endif
+#ifndef VERIFY_SCRIPT_CONDITION_CACHE
+	if (hasCachedResult) {
+		return pScript->getCachedConditionResult();
+	}
+#endif
+
 	OrCondition *pConditionHead = pScript->getOrCondition();
 	Bool testValue = false;
 
@@ -7616,6 +7775,15 @@ Bool ScriptEngine::evaluateConditions( Script *pScript, Team *thisTeam, Player *
 	pScript->addToConditionTime(timeToEvaluate);
 #endif
 
+#ifdef VERIFY_SCRIPT_CONDITION_CACHE
+	DEBUG_ASSERTCRASH(!hasCachedResult || testValue == pScript->getCachedConditionResult(),
+		("Cached condition result of script '%s' is stale.", pScript->getName().str()));
+#endif
+	if (useCachedResult) {
+		const UnsignedInt timerVersion = conditionsReadCountdownTimers(pScript) ? m_countdownTimerVersion : 0;
+		pScript->setCachedConditionResult(testValue, m_scriptVariableVersion, timerVersion);
+	}
+
 	return testValue; // If none of the or's fired, then it is false.
 }
 
@@ -7629,6 +7797,7 @@ void ScriptEngine::executeActions( ScriptAction *pActionHead )
 	ScriptAction *pCurAction;
 	UnicodeString uStr1;
 	for (pCurAction = pActionHead; pCurAction; pCurAction = pCurAction->getNext()) {
+		LOGIC_PROFILE_SECTION(CATEGORY_SCRIPT_ACTION, pCurAction->getActionType());
 		switch (pCurAction->getActionType()) {
 			default: if (TheScriptActions) TheScriptActions->executeAction(pCurAction); break;
 			case ScriptAction::SET_COUNTER: setCounter(pCurAction);	break;
@@ -7711,6 +7880,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 void ScriptEngine::createNamedCache()
 {
 	m_namedObjects.clear();
+	m_namedObjectIndex.clear();
 
 	if( !TheGameLogic )
 	{
@@ -7720,10 +7890,7 @@ void ScriptEngine::createNamedCache()
 
 	while (pObj) {
 		if (!pObj->getName().isEmpty()) {
-			NamedRequest req;
-			req.first = pObj->getName();
-			req.second = pObj;
-			m_namedObjects.push_back(req);
+			appendNamedObject(pObj->getName(), pObj);
 		}
 		pObj = pObj->getNextObject();
 	}
@@ -8948,6 +9115,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 
 	// num flags
 	xfer->xferInt( &m_numFlags );
+	noteScriptVariablesChanged();
 
 	// attack priority info
 	UnsignedShort attackPriorityInfoSize = m_numAttackInfo;
@@ -9002,13 +9170,12 @@ void ScriptEngine::xfer( Xfer *xfer )
 	}
 	else
 	{
-		NamedRequest req;
-
 		//
 		// list should be empty, it is legal for it to not be empty at this point
 		// according to John M., so we're clearing it now
 		//
 		m_namedObjects.clear();
+		m_namedObjectIndex.clear();
 
 		// read each element
 		for( UnsignedShort i = 0; i < namedObjectsCount; ++i )
@@ -9029,9 +9196,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 			}
 
 			// assign
-			req.first = namedObjectName;
-			req.second = obj;
-			m_namedObjects.push_back( req );
+			appendNamedObject( namedObjectName, obj );
 
 		}
 
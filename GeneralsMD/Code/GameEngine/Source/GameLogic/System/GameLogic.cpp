@@ -41,6 +41,7 @@
 #include "Common/GameUtility.h"
 #include "Common/INI.h"
 #include "Common/LatchRestore.h"
+#include "Common/LogicProfiler.h"
 #include "Common/MapObject.h"
 #include "Common/MultiplayerSettings.h"
 #include "Common/OSDisplay.h"
@@ -472,9 +473,9 @@ void GameLogic::reset()
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	m_normalUpdates.clear();
 #endif
-	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
+	for (std::vector<SleepyUpdateEntry>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
 	{
-		(*it)->friend_setIndexInLogic(-1);
+		it->module->friend_setIndexInLogic(-1);
 	}
 	m_sleepyUpdates.clear();
 	m_curUpdateModule = nullptr;
@@ -2587,24 +2588,40 @@ void GameLogic::processDestroyList()
 			of the objects in the world every frame, we come out well ahead this way.)
 		*/
 
+		// TheSuperHackers @performance Find the sleepy updates of this object through its own modules instead
+		// of scanning the whole queue. Sorting them by queue index gives the same order as the scan did, so
+		// they are erased in the same order and the queue ends up the same.
 		const Int MAX_SUO = 256;
+		Int sleepyUpdateIndicesForThisObject[MAX_SUO];
 		UpdateModulePtr sleepyUpdatesForThisObject[MAX_SUO];
 		Int numSUO = 0;
 
-		for (std::vector<UpdateModulePtr>::iterator it2 = m_sleepyUpdates.begin(); it2 != m_sleepyUpdates.end(); ++it2)
+		for (BehaviorModule** b = currentObject->getBehaviorModules(); *b && numSUO < MAX_SUO; ++b)
 		{
-			UpdateModulePtr u = *it2;
-			if (u->friend_getObject() == currentObject && numSUO < MAX_SUO)
+#ifdef DIRECT_UPDATEMODULE_ACCESS
+			// evil, but necessary at this point. (srj)
+			UpdateModulePtr u = (UpdateModulePtr)((*b)->getUpdate());
+#else
+			UpdateModulePtr u = (*b)->getUpdate();
+#endif
+			if (u && u->friend_getIndexInLogic() >= 0)
 			{
-				sleepyUpdatesForThisObject[numSUO++] = u;
+				sleepyUpdateIndicesForThisObject[numSUO++] = u->friend_getIndexInLogic();
 			}
 		}
 
+		std::sort(sleepyUpdateIndicesForThisObject, sleepyUpdateIndicesForThisObject + numSUO);
+		for (Int suo = 0; suo < numSUO; ++suo)
+		{
+			sleepyUpdatesForThisObject[suo] = m_sleepyUpdates[sleepyUpdateIndicesForThisObject[suo]].module;
+			DEBUG_ASSERTCRASH(sleepyUpdatesForThisObject[suo]->friend_getObject() == currentObject, ("Hmm, expected update of this object here"));
+		}
+
 		for (--numSUO; numSUO >= 0; --numSUO)
 		{
 			// have to re-get idx each time since each call to erase might change others.
 			Int idx = sleepyUpdatesForThisObject[numSUO]->friend_getIndexInLogic();
-			DEBUG_ASSERTCRASH(m_sleepyUpdates[idx] == sleepyUpdatesForThisObject[numSUO], ("Hmm, expected update mismatch here"));
+			DEBUG_ASSERTCRASH(m_sleepyUpdates[idx].module == sleepyUpdatesForThisObject[numSUO], ("Hmm, expected update mismatch here"));
 			eraseSleepyUpdate(idx);
 			DEBUG_ASSERTCRASH(sleepyUpdatesForThisObject[numSUO]->friend_getIndexInLogic() == -1, ("Hmm, expected index to be -1 here"));
 		}
@@ -2835,28 +2852,29 @@ inline void GameLogic::validateSleepyUpdate() const
 	//DEBUG_LOG(("\n"));
 	//for (i = 0; i < sz; ++i)
 	//{
-	//	DEBUG_LOG(("u %04d: %08lx %08lx",i,m_sleepyUpdates[i],m_sleepyUpdates[i]->friend_getNextCallFrame()));
+	//	DEBUG_LOG(("u %04d: %08lx %08lx",i,m_sleepyUpdates[i].module,m_sleepyUpdates[i].module->friend_getNextCallFrame()));
 	//}
 	for (i = 0; i < sz; ++i)
 	{
-		DEBUG_ASSERTCRASH(m_sleepyUpdates[i]->friend_getIndexInLogic() == i, ("index mismatch: expected %d, got %d",i,m_sleepyUpdates[i]->friend_getIndexInLogic()));
-		UnsignedInt pri = m_sleepyUpdates[i]->friend_getPriority();
+		DEBUG_ASSERTCRASH(m_sleepyUpdates[i].module->friend_getIndexInLogic() == i, ("index mismatch: expected %d, got %d",i,m_sleepyUpdates[i].module->friend_getIndexInLogic()));
+		DEBUG_ASSERTCRASH(m_sleepyUpdates[i].priority == m_sleepyUpdates[i].module->friend_getPriority(), ("stale sleepy update priority"));
+		UnsignedInt pri = m_sleepyUpdates[i].priority;
 		if (i > 0)
 		{
 			Int i0 = (i+1)/2-1;
-			UnsignedInt pri0 = m_sleepyUpdates[i0]->friend_getPriority();
+			UnsignedInt pri0 = m_sleepyUpdates[i0].priority;
 			DEBUG_ASSERTCRASH(pri >= pri0, ("sleepyUpdates are munged (0)"));
 		}
 		Int i1 = 2*(i+1)-1;
 		Int i2 = 2*(i+1);
 		if (i1 < sz)
 		{
-			UnsignedInt pri1 = m_sleepyUpdates[i1]->friend_getPriority();
+			UnsignedInt pri1 = m_sleepyUpdates[i1].priority;
 			DEBUG_ASSERTCRASH(pri <= pri1, ("sleepyUpdates are munged (1)"));
 		}
 		if (i2 < sz)
 		{
-			UnsignedInt pri2 = m_sleepyUpdates[i2]->friend_getPriority();
+			UnsignedInt pri2 = m_sleepyUpdates[i2].priority;
 			DEBUG_ASSERTCRASH(pri <= pri2, ("sleepyUpdates are munged (2)"));
 		}
 	}
@@ -2871,13 +2889,13 @@ void GameLogic::eraseSleepyUpdate(Int i)
 	DEBUG_ASSERTCRASH(i >= 0 && i < m_sleepyUpdates.size(), ("bad sleepy idx"));
 
 	// swap with the final item, toss the final item, then rebalance
-	m_sleepyUpdates[i]->friend_setIndexInLogic(-1);
+	m_sleepyUpdates[i].module->friend_setIndexInLogic(-1);
 
 	Int last = m_sleepyUpdates.size() - 1;
 	if (i < last)
 	{
 		m_sleepyUpdates[i] = m_sleepyUpdates[last];
-		m_sleepyUpdates[i]->friend_setIndexInLogic(i);
+		m_sleepyUpdates[i].module->friend_setIndexInLogic(i);
 		m_sleepyUpdates.pop_back();
 		rebalanceSleepyUpdate(i);
 	}
@@ -2888,15 +2906,13 @@ void GameLogic::eraseSleepyUpdate(Int i)
 }
 
 // ------------------------------------------------------------------------------------------------
-inline Bool isLowerPriority(const UpdateModulePtr a, const UpdateModulePtr b)
+inline Bool isLowerPriority(const SleepyUpdateEntry& a, const SleepyUpdateEntry& b)
 {
 	// return true iff a is lower pri than b.
 	// remember: lower ordinal value means higher priority.
 	// therefore, higher ordinal value means lower priority.
-	DEBUG_ASSERTCRASH(a && b, ("these may no longer be null"));
-	UnsignedInt f1 = a->friend_getPriority();
-	UnsignedInt f2 = b->friend_getPriority();
-	return f1 > f2;
+	DEBUG_ASSERTCRASH(a.module && b.module, ("these may no longer be null"));
+	return a.priority > b.priority;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -2909,14 +2925,14 @@ Int GameLogic::rebalanceParentSleepyUpdate(Int i)
 	Int parent = ((i+1)>>1)-1;
 	while (parent >= 0 && isLowerPriority(m_sleepyUpdates[parent], m_sleepyUpdates[i]))
 	{
-		UpdateModulePtr a = m_sleepyUpdates[parent];
-		UpdateModulePtr b = m_sleepyUpdates[i];
+		SleepyUpdateEntry a = m_sleepyUpdates[parent];
+		SleepyUpdateEntry b = m_sleepyUpdates[i];
 
 		m_sleepyUpdates[i] = a;
 		m_sleepyUpdates[parent] = b;
 
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(parent);
+		a.module->friend_setIndexInLogic(i);
+		b.module->friend_setIndexInLogic(parent);
 
 		i = parent;
 		parent = ((parent+1)>>1)-1;
@@ -2937,12 +2953,12 @@ Int GameLogic::rebalanceChildSleepyUpdate(Int i)
 // max efficiency. I have left the pristine non-unrolled
 // version present for clarity. (Yes, this is worth doing.) (srj)
 #if 1
-	UpdateModulePtr* pI = &m_sleepyUpdates[i];
+	SleepyUpdateEntry* pI = &m_sleepyUpdates[i];
 
 	// our children are i*2 and i*2+1
   Int child = ((i)<<1)+1;
-	UpdateModulePtr* pChild = &m_sleepyUpdates[0] + child;
-	UpdateModulePtr* pSZ = &m_sleepyUpdates[0] + m_sleepyUpdates.size();	// yes, this is off the end.
+	SleepyUpdateEntry* pChild = &m_sleepyUpdates[0] + child;
+	SleepyUpdateEntry* pSZ = &m_sleepyUpdates[0] + m_sleepyUpdates.size();	// yes, this is off the end.
 
   while (pChild < pSZ)
 	{
@@ -2960,14 +2976,14 @@ Int GameLogic::rebalanceChildSleepyUpdate(Int i)
 		}
 
 		// doh. swap with the highest-pri child we have.
-		UpdateModulePtr a = *pChild;
-		UpdateModulePtr b = *pI;
+		SleepyUpdateEntry a = *pChild;
+		SleepyUpdateEntry b = *pI;
 
 		*pI = a;
 		*pChild = b;
 
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(child);
+		a.module->friend_setIndexInLogic(i);
+		b.module->friend_setIndexInLogic(child);
 
 		i = child;
 		pI = pChild;
@@ -2992,14 +3008,14 @@ Int GameLogic::rebalanceChildSleepyUpdate(Int i)
 		}
 
 		// doh. swap with the highest-pri child we have.
-		UpdateModulePtr a = m_sleepyUpdates[child];
-		UpdateModulePtr b = m_sleepyUpdates[i];
+		SleepyUpdateEntry a = m_sleepyUpdates[child];
+		SleepyUpdateEntry b = m_sleepyUpdates[i];
 
 		m_sleepyUpdates[i] = a;
 		m_sleepyUpdates[child] = b;
 
-		a->friend_setIndexInLogic(i);
-		b->friend_setIndexInLogic(child);
+		a.module->friend_setIndexInLogic(i);
+		b.module->friend_setIndexInLogic(child);
 		i = child;
 		child = ((i)<<1)+1;
   }
@@ -3040,7 +3056,10 @@ void GameLogic::pushSleepyUpdate(UpdateModulePtr u)
 
 	DEBUG_ASSERTCRASH(u != nullptr, ("You may not pass null for sleepy update info"));
 
-	m_sleepyUpdates.push_back(u);
+	SleepyUpdateEntry entry;
+	entry.priority = u->friend_getPriority();
+	entry.module = u;
+	m_sleepyUpdates.push_back(entry);
 	u->friend_setIndexInLogic(m_sleepyUpdates.size() - 1);
 
 	rebalanceParentSleepyUpdate(m_sleepyUpdates.size()-1);
@@ -3051,7 +3070,7 @@ UpdateModulePtr GameLogic::peekSleepyUpdate() const
 {
 	USE_PERF_TIMER(SleepyMaintenance)
 
-	UpdateModulePtr u = m_sleepyUpdates.front();
+	UpdateModulePtr u = m_sleepyUpdates.front().module;
 	DEBUG_ASSERTCRASH(u->friend_getIndexInLogic() == 0, ("index mismatch: expected %d, got %d",0,u->friend_getIndexInLogic()));
 	return u;
 }
@@ -3068,11 +3087,11 @@ void GameLogic::popSleepyUpdate()
 		return;
 	}
 
-	m_sleepyUpdates[0]->friend_setIndexInLogic(-1);
+	m_sleepyUpdates[0].module->friend_setIndexInLogic(-1);
 	if (sz > 1)
 	{
 		m_sleepyUpdates[0] = m_sleepyUpdates[sz-1];
-		m_sleepyUpdates[0]->friend_setIndexInLogic(0);
+		m_sleepyUpdates[0].module->friend_setIndexInLogic(0);
 		m_sleepyUpdates.pop_back();
 		rebalanceChildSleepyUpdate(0);
 	}
@@ -3082,6 +3101,15 @@ void GameLogic::popSleepyUpdate()
 	}
 }
 
+// ------------------------------------------------------------------------------------------------
+// Call after changing the next call frame of a module in the queue, before rebalancing it.
+void GameLogic::refreshSleepyUpdatePriority(UpdateModulePtr u)
+{
+	Int idx = u->friend_getIndexInLogic();
+	DEBUG_ASSERTCRASH(idx >= 0 && idx < m_sleepyUpdates.size() && m_sleepyUpdates[idx].module == u, ("sleepy update module index mismatch"));
+	m_sleepyUpdates[idx].priority = u->friend_getPriority();
+}
+
 // ------------------------------------------------------------------------------------------------
 // this should be called only by UpdateModule, thanks.
 // ------------------------------------------------------------------------------------------------
@@ -3120,7 +3148,7 @@ void GameLogic::friend_awakenUpdateModule(Object* obj, UpdateModulePtr u, Unsign
 			return;
 		}
 
-		if (m_sleepyUpdates[idx] != u)
+		if (m_sleepyUpdates[idx].module != u)
 		{
 			RELEASE_CRASH("fatal error! sleepy update module index mismatch.");
 			return;
@@ -3128,6 +3156,7 @@ void GameLogic::friend_awakenUpdateModule(Object* obj, UpdateModulePtr u, Unsign
 
 		// update the value.
 		u->friend_setNextCallFrame(whenToWakeUp);
+		refreshSleepyUpdatePriority(u);
 
 		// rebalance.
 		rebalanceSleepyUpdate(idx);
@@ -3721,6 +3750,8 @@ void GameLogic::update()
 	#endif
 	}
 
+	LOGIC_PROFILE_FRAME;
+
 	// send the current time to the GameClient
 	UnsignedInt now = getFrame();
 	TheGameClient->setFrame(now);
@@ -3803,6 +3834,7 @@ void GameLogic::update()
 #endif
 			{
 				USE_PERF_TIMER(GameLogic_update_normal)
+				LOGIC_PROFILE_SECTION(CATEGORY_UPDATE_MODULE, u->getModuleNameKey());
 
 				m_curUpdateModule = u;
 
@@ -3851,6 +3883,7 @@ void GameLogic::update()
 #endif
 			{
 				USE_PERF_TIMER(GameLogic_update_sleepy)
+				LOGIC_PROFILE_SECTION(CATEGORY_UPDATE_MODULE, u->getModuleNameKey());
 
 				//DEBUG_LOG(("calling update %08lx (%d %d)...",update,update->friend_getNextCallFrame(),update->friend_getNextCallPhase()));
 				m_curUpdateModule = u;
@@ -3866,6 +3899,7 @@ void GameLogic::update()
 
 			// else defer it till next frame and re-push it
 			u->friend_setNextCallFrame(now + sleepLen);
+			refreshSleepyUpdatePriority(u);
 			rebalanceSleepyUpdate(0);
 		}
 	}
@@ -4129,6 +4163,8 @@ UnsignedInt GameLogic::getCRC( Int mode, AsciiString deepCRCFileName )
 	if (mode != CRC_RECALC)
 		return m_CRC;
 
+	LOGIC_PROFILE_SECTION_NAME(CATEGORY_GAME_LOGIC, "getCRC");
+
 	setFPMode();
 
 	LatchRestore<Bool> latch(inCRCGen, !isInGameLogicUpdate());
@@ -5361,9 +5397,9 @@ void GameLogic::loadPostProcess()
 			m_nextObjID = (ObjectID)((UnsignedInt)obj->getID() + 1);
 
 	// blow away the sleepy update and normal update module lists
-	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
+	for (std::vector<SleepyUpdateEntry>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
 	{
-		(*it)->friend_setIndexInLogic(-1);
+		it->module->friend_setIndexInLogic(-1);
 	}
 	m_sleepyUpdates.clear();
 #ifdef ALLOW_NONSLEEPY_UPDATES
@@ -5407,7 +5443,10 @@ void GameLogic::loadPostProcess()
 				u->friend_setNextCallFrame(now);
 #endif
 			{
-				m_sleepyUpdates.push_back(u);
+				SleepyUpdateEntry entry;
+				entry.priority = u->friend_getPriority();
+				entry.module = u;
+				m_sleepyUpdates.push_back(entry);
 				u->friend_setIndexInLogic(m_sleepyUpdates.size() - 1);
 			}
 
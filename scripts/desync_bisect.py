@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+# Copyright 2026 TheSuperHackers
+#
+# This file is part of Command & Conquer: Generals and Command & Conquer: Zero Hour.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+"""
+Desync bisection for GeneralsGameCode.
+
+Simulates one replay headless with two builds, or one build with two option
+sets, and finds where their game logic diverges:
+
+1. Both simulations write a -desyncTrace with the GameLogic CRC of every frame.
+   The first frame with a different CRC is the first visible divergence.
+2. Both simulations dump the logic state at that frame with -desyncDump. The
+   dumps are compared to find the first diverging object, module and field.
+3. With --window, the dumps are bisected over the frames before it, because
+   state that is not part of the CRC can diverge earlier than the CRC does.
+
+With --checkpoint-interval the first simulation of A also writes replay
+checkpoints, so the dump simulations of A continue from the nearest checkpoint
+instead of simulating the replay from the start. There is one checkpoint file
+next to the replay and it holds the state of A, so B always simulates from the
+start, even when A and B use the same executable. Seeking B to a checkpoint of
+A would hide every difference that arose before it.
+
+Usage:
+  python desync_bisect.py --exe-a good/generalszh.exe --exe-b bad/generalszh.exe --replay desync.rep
+  python desync_bisect.py --exe-a build/generalszh.exe --args-b "-someOption" --replay desync.rep --window 3000 --checkpoint-interval 900
+
+Exits with 0 if the simulations do not diverge, 1 if they do and 2 on errors.
+"""
+
+import argparse
+import shlex
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+TRACE_COLUMNS = ['logicCRC', 'objectsCRC', 'partitionCRC', 'playersCRC', 'aiCRC']
+
+
+class Simulation:
+    """One side of the comparison: an executable with its extra arguments."""
+
+    def __init__(self, name: str, exe: Path, extra_args: List[str], work_dir: Path):
+        self.name = name
+        self.exe = exe
+        self.extra_args = extra_args
+        self.work_dir = work_dir
+        self.wrote_checkpoints = False
+
+    def run(self, replay: str, trace: Path, extra: List[str]) -> None:
+        command = [str(self.exe), '-headless', '-replay', replay, '-desyncTrace', str(trace)]
+        command += extra + self.extra_args
+        print(f'[{self.name}] {" ".join(command)}', flush=True)
+        # The simulation fails when the replay itself mismatches, which is expected here.
+        subprocess.run(command, cwd=self.exe.parent, stdout=subprocess.DEVNULL)
+        if not trace.exists():
+            raise RuntimeError(f'{self.name} did not write the desync trace {trace}')
+
+    def trace(self, replay: str, checkpoint_interval: int) -> Dict[int, Tuple[str, ...]]:
+        trace = self.work_dir / f'{self.name}.trace'
+        extra = ['-replayCheckpoints', str(checkpoint_interval)] if checkpoint_interval > 0 else []
+        self.run(replay, trace, extra)
+        self.wrote_checkpoints = checkpoint_interval > 0
+        return read_trace(trace)
+
+    def dump(self, replay: str, frame: int) -> Path:
+        trace = self.work_dir / f'{self.name}.{frame}.trace'
+        extra = ['-desyncDump', str(frame)]
+        # Only seek with checkpoints of this simulation, the state of the other one would be restored otherwise
+        if self.wrote_checkpoints:
+            extra += ['-replaySeek', str(frame)]
+        self.run(replay, trace, extra)
+        dump = Path(str(trace) + '.dump')
+        if not dump.exists():
+            raise RuntimeError(f'{self.name} did not reach frame {frame}, no dump was written')
+        return dump
+
+
+def read_trace(path: Path) -> Dict[int, Tuple[str, ...]]:
+    """Return the CRC columns of every frame of a desync trace."""
+    frames = {}
+    with open(path, 'r', encoding='utf-8') as f:
+        for line in f:
+            if line.startswith('#'):
+                continue
+            fields = line.split()
+            if len(fields) == len(TRACE_COLUMNS) + 1:
+                frames[int(fields[0])] = tuple(fields[1:])
+    return frames
+
+
+def first_diverging_frame(a: Dict[int, Tuple[str, ...]], b: Dict[int, Tuple[str, ...]]) -> Optional[int]:
+    for frame in sorted(set(a) & set(b)):
+        if a[frame] != b[frame]:
+            return frame
+    return None
+
+
+def read_dump(path: Path) -> Dict[str, List[str]]:
+    """Return the lines of every section of a dump, keyed by the section name without the CRC."""
+    sections = {}
+    lines = None
+    with open(path, 'r', encoding='utf-8', errors='replace') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if line.startswith('['):
+                name = line[1:-1]
+                key = name.split(' crc=')[0]
+                lines = [name]
+                sections[key] = lines
+            elif lines is not None:
+                lines.append(line)
+    return sections
+
+
+def field_path(lines: List[str], index: int) -> str:
+    """Describe where lines[index] is, from the strings that name the enclosing blocks, such as module tags."""
+    path = []
+    last_string = None
+    for line in lines[1:index]:
+        text = line.strip()
+        if text == '{':
+            path.append(last_string or 'block')
+            last_string = None
+        elif text == '}':
+            if path:
+                path.pop()
+            last_string = None
+        elif text.startswith('string '):
+            last_string = text[len('string '):].strip('"')
+    return ' / '.join(path) if path else '(top level)'
+
+
+def compare_dumps(dump_a: Path, dump_b: Path) -> List[str]:
+    """Return a report of the first difference between two dumps, or an empty list if they are equal."""
+    a = read_dump(dump_a)
+    b = read_dump(dump_b)
+    report = []
+
+    only_a = [key for key in a if key not in b]
+    only_b = [key for key in b if key not in a]
+    if only_a:
+        report.append(f'Only in A: {only_a[0]}' + (f' and {len(only_a) - 1} more' if len(only_a) > 1 else ''))
+    if only_b:
+        report.append(f'Only in B: {only_b[0]}' + (f' and {len(only_b) - 1} more' if len(only_b) > 1 else ''))
+
+    differing = [key for key in a if key in b and a[key] != b[key]]
+    if differing:
+        key = differing[0]
+        lines_a = a[key]
+        lines_b = b[key]
+        report.append(f'First diverging section: {key} ({len(differing)} sections differ)')
+        if lines_a[0] != lines_b[0]:
+            report.append(f'  A: [{lines_a[0]}]')
+            report.append(f'  B: [{lines_b[0]}]')
+        for i in range(1, max(len(lines_a), len(lines_b))):
+            line_a = lines_a[i] if i < len(lines_a) else '<end>'
+            line_b = lines_b[i] if i < len(lines_b) else '<end>'
+            if line_a != line_b:
+                report.append(f'  Path: {field_path(lines_a if i < len(lines_a) else lines_b, i)}')
+                report.append(f'  A: {line_a.strip()}')
+                report.append(f'  B: {line_b.strip()}')
+                break
+    return report
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Find the first diverging frame, object, module and field of two replay simulations')
+    parser.add_argument('--exe-a', type=Path, required=True, help='Game executable of simulation A')
+    parser.add_argument('--exe-b', type=Path, help='Game executable of simulation B (default: the one of A)')
+    parser.add_argument('--args-a', default='', help='Extra command line arguments of simulation A')
+    parser.add_argument('--args-b', default='', help='Extra command line arguments of simulation B')
+    parser.add_argument('--replay', required=True, help='Replay to simulate, relative to the replay folder')
+    parser.add_argument('--window', type=int, default=0, help='Bisect the dumps over this many frames before the first CRC difference (default: 0)')
+    parser.add_argument('--checkpoint-interval', type=int, default=0, help='Write replay checkpoints of A with this interval to speed up the dumps of A (default: off)')
+    parser.add_argument('--work-dir', type=Path, help='Keep the traces and dumps in this folder instead of a temporary one')
+    args = parser.parse_args()
+
+    exe_a = args.exe_a.resolve()
+    exe_b = args.exe_b.resolve() if args.exe_b else exe_a
+
+    with tempfile.TemporaryDirectory() as tmp:
+        work_dir = args.work_dir.resolve() if args.work_dir else Path(tmp)
+        work_dir.mkdir(parents=True, exist_ok=True)
+        sim_a = Simulation('A', exe_a, shlex.split(args.args_a), work_dir)
+        sim_b = Simulation('B', exe_b, shlex.split(args.args_b), work_dir)
+
+        try:
+            trace_a = sim_a.trace(args.replay, args.checkpoint_interval)
+            # B must not write checkpoints, they would replace the ones of A
+            trace_b = sim_b.trace(args.replay, 0)
+
+            frame = first_diverging_frame(trace_a, trace_b)
+            if frame is None:
+                common = len(set(trace_a) & set(trace_b))
+                print(f'No divergence in the {common} frames both simulations ran')
+                return 0
+
+            diverging = [name for name, x, y in zip(TRACE_COLUMNS, trace_a[frame], trace_b[frame]) if x != y]
+            print(f'First CRC difference at frame {frame} in {", ".join(diverging)}')
+
+            # Find the first frame where the dumps differ. They differ at the CRC difference.
+            lo = max(0, frame - args.window)
+            hi = frame
+            if lo < hi:
+                if not compare_dumps(sim_a.dump(args.replay, lo), sim_b.dump(args.replay, lo)):
+                    while hi - lo > 1:
+                        mid = (lo + hi) // 2
+                        if compare_dumps(sim_a.dump(args.replay, mid), sim_b.dump(args.replay, mid)):
+                            hi = mid
+                        else:
+                            lo = mid
+                else:
+                    print(f'The logic state already differs at frame {lo}, increase --window to search further back')
+                    hi = lo
+
+            report = compare_dumps(sim_a.dump(args.replay, hi), sim_b.dump(args.replay, hi))
+        except (OSError, RuntimeError, ValueError) as e:
+            print(f'Error: {e}', file=sys.stderr)
+            return 2
+
+        print(f'First logic state difference at frame {hi}:')
+        for line in report or ['The dumps are equal, the difference is in state that is not dumped']:
+            print(line)
+        return 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
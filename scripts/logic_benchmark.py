@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+# Copyright 2026 TheSuperHackers
+#
+# This file is part of Command & Conquer: Generals and Command & Conquer: Zero Hour.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+"""
+Logic performance benchmark for GeneralsGameCode.
+
+Simulates a pinned set of replays headless with -logicProfile, prints the
+logic frame rate, per-frame logic time percentiles, peak memory pool usage,
+the time of a full game logic CRC and pathfinder work, and compares them
+against a stored baseline.
+
+Usage:
+  python logic_benchmark.py --exe build/generalszh.exe --replays benchmark/*.rep --baseline baseline.json
+  python logic_benchmark.py --exe build/generalszh.exe --replays benchmark/*.rep --baseline baseline.json --update-baseline
+
+The replay paths are passed to -replay as they are, so they are relative to the
+replay folder of the game and may contain wildcards. Exits with 1 if a metric regressed by more than the
+tolerance, or if the replays could not be simulated.
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+from typing import Dict, List
+
+
+def section_ms_per_call(report, category: str, name: str) -> float:
+    """Return the average time of a profiled section, or 0 if it never ran."""
+    for section in report['sections']:
+        if section['category'] == category and section['name'] == name and section['calls'] > 0:
+            return section['totalMs'] / section['calls']
+    return 0.0
+
+
+# Metric name, getter from the logic profile report, True if higher is better.
+METRICS = [
+    ('logicFps', lambda report: report['logicFps'], True),
+    ('frameMsP50', lambda report: report['frameMsP50'], False),
+    ('frameMsP99', lambda report: report['frameMsP99'], False),
+    ('peakPoolBytes', lambda report: report['peakPoolBytes'], False),
+    ('crcMsPerCall', lambda report: section_ms_per_call(report, 'GameLogic', 'getCRC'), False),
+    ('pathfindCellsExpanded', lambda report: report['counters']['pathfindCellsExpanded'], False),
+]
+
+# Work counters depend only on the simulation, so any change means the logic behaves differently.
+EXACT_METRICS = {'pathfindCellsExpanded'}
+
+
+def run_benchmark(exe: Path, replays: List[str], profile_basename: Path) -> Dict[str, float]:
+    """Simulate the replays and return the metrics of the logic profile."""
+    command = [str(exe), '-headless', '-logicProfile', str(profile_basename)]
+    for replay in replays:
+        command += ['-replay', replay]
+    result = subprocess.run(command, cwd=exe.parent)
+    if result.returncode != 0:
+        raise RuntimeError(f'Replay simulation failed with exit code {result.returncode}')
+
+    with open(profile_basename.with_suffix('.json'), 'r', encoding='utf-8') as f:
+        report = json.load(f)
+
+    metrics = {'frames': report['frames']}
+    for name, getter, _ in METRICS:
+        metrics[name] = getter(report)
+    return metrics
+
+
+def compare(metrics: Dict[str, float], baseline: Dict[str, float], tolerance: float) -> List[str]:
+    """Return a message for every metric that is worse than the baseline by more than the tolerance."""
+    regressions = []
+    if metrics['frames'] != baseline.get('frames'):
+        regressions.append(f"frames: {metrics['frames']} != baseline {baseline.get('frames')}, the replay set changed")
+
+    for name, _, higher_is_better in METRICS:
+        if name not in baseline:
+            continue
+        value = metrics[name]
+        expected = baseline[name]
+        if name in EXACT_METRICS:
+            if value != expected:
+                regressions.append(f'{name}: {value} != baseline {expected}')
+            continue
+        if higher_is_better:
+            limit = expected * (1.0 - tolerance)
+            if value < limit:
+                regressions.append(f'{name}: {value:.4f} < {limit:.4f} (baseline {expected:.4f})')
+        else:
+            limit = expected * (1.0 + tolerance)
+            if value > limit:
+                regressions.append(f'{name}: {value:.4f} > {limit:.4f} (baseline {expected:.4f})')
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Replay driven logic performance benchmark')
+    parser.add_argument('--exe', type=Path, required=True, help='Game executable')
+    parser.add_argument('--replays', nargs='+', required=True, help='Replays to simulate, relative to the replay folder')
+    parser.add_argument('--baseline', type=Path, required=True, help='Baseline metrics json')
+    parser.add_argument('--tolerance', type=float, default=0.05, help='Allowed relative regression of timing and memory metrics (default: 0.05)')
+    parser.add_argument('--update-baseline', action='store_true', help='Write the measured metrics to the baseline instead of comparing')
+    parser.add_argument('--output', type=Path, help='Write the measured metrics to this json file')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        try:
+            metrics = run_benchmark(args.exe.resolve(), args.replays, Path(tmp) / 'logic_profile')
+        except (OSError, RuntimeError, KeyError, ValueError) as e:
+            print(f'Error: {e}', file=sys.stderr)
+            return 1
+
+    print(json.dumps(metrics, indent=2))
+    if args.output:
+        args.output.write_text(json.dumps(metrics, indent=2) + '\n', encoding='utf-8')
+
+    if args.update_baseline:
+        args.baseline.write_text(json.dumps(metrics, indent=2) + '\n', encoding='utf-8')
+        print(f'Baseline written to {args.baseline}')
+        return 0
+
+    if not args.baseline.exists():
+        print(f'Error: baseline {args.baseline} does not exist, create it with --update-baseline', file=sys.stderr)
+        return 1
+
+    baseline = json.loads(args.baseline.read_text(encoding='utf-8'))
+    regressions = compare(metrics, baseline, args.tolerance)
+    if regressions:
+        print('Logic performance regressed:')
+        for regression in regressions:
+            print(f'  {regression}')
+        return 1
+
+    print('Logic performance is within tolerance of the baseline')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())